@@ -13,16 +13,46 @@
  * qui représente le nombre de tentatives de hachage faites.  Il retourne un index (hash) de la forme:
  * H(clef) = ( h(clef) + f(i) ) % module
  * où h() est la fonction de hachage primaire, et f(i) est la fonction de résolution des collisions
+ *
+ * Les tables qui conservent des bits du hash (voir TableHachageCompacte, TableHachageChaines, ou TableHachage avec
+ * HacheurHashConserve) utilisent aussi deux méthodes: primaire(clef), qui retourne h(clef), et indice(h, n), qui
+ * retourne ( h + f(n) ) % module sans rehacher la clef.
+ * TableHachage utilise en plus, s'il est offert, suivant(index, h, n), qui donne H(clef, n) à partir de la position
+ * précédente index = H(clef, n - 1): chaque clef n'est alors hachée qu'une fois par séquence de sondage.
+ *
+ * Les foncteurs de chaînes prennent un std::string_view: une std::string, un const char * ou une tranche d'un tampon
+ * sont hachés de la même façon, sans construire de std::string temporaire.
+ *
+ * HString1, HString2 et HInt1 sont conservés pour comparaison; HString3 et HInt3 distribuent beaucoup mieux les
+ * clefs semblables (URL de même préfixe, entiers en progression) et HString3 lit 16 à 32 octets par étape.
+ *
+ * HacheurCompose assemble un hachage primaire, une politique de sondage (PolitiquesSondage.h) et une politique de
+ * capacité (PolitiquesCapacite.h). Les HacheurQuad* en sont des instances qui réduisent leurs index modulo une
+ * capacité première (CapacitePremiere), alors que les HacheurTriang* les réduisent par masque et exigent une capacité
+ * en puissance de deux (CapacitePuissanceDeux).
+ *
+ * HacheurDouble tire le pas de sa séquence d'une seconde fonction de hachage (HString2 ou HInt2 pour les
+ * HacheurDouble*): la séquence visite toutes les positions et la table peut être remplie à 80 %.
  */
 
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "ContratException.h"
+#include "PolitiquesCapacite.h"
+#include "PolitiquesSondage.h"
+
 namespace labTableHachage {
 /**
  * \class HString1
- * \brief Foncteur de hachage pour des string
+ * \brief Foncteur de hachage pour des string. Accepte toute chaîne convertible en std::string_view, avec le même
+ * hash pour des chaînes égales.
  */
     class HString1 {
     public:
-        size_t operator()(const std::string &p_clef) const {
+        size_t operator()(std::string_view p_clef) const {
             size_t total = 0;
             int nPremiers = 18;
             size_t premiers[18] = {11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53,
@@ -40,11 +70,12 @@ namespace labTableHachage {
 
 /**
  * \class HString2
- * \brief Foncteur de hachage pour des string
+ * \brief Foncteur de hachage pour des string. Accepte toute chaîne convertible en std::string_view, avec le même
+ * hash pour des chaînes égales.
  */
     class HString2 {
     public:
-        size_t operator()(const std::string &p_clef) const {
+        size_t operator()(std::string_view p_clef) const {
             size_t total = 5381;
             for (size_t i = 0; i < p_clef.size(); ++i) {
                 total = total * 33 ^ p_clef[i];
@@ -53,6 +84,90 @@ namespace labTableHachage {
         }
     };
 
+    /**
+     * @brief Multiplie deux mots de 64 bits et combine les deux moitiés du produit de 128 bits par ou exclusif. Chaque
+     * bit du résultat dépend de presque tous les bits des deux opérandes.
+     * @param p_a Le premier opérande
+     * @param p_b Le second opérande
+     * @return Les 64 bits faibles du produit, combinés aux 64 bits forts
+     */
+    inline uint64_t melangerProduit(uint64_t p_a, uint64_t p_b) {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 produit = static_cast<unsigned __int128>(p_a) * p_b;
+        return static_cast<uint64_t>(produit) ^ static_cast<uint64_t>(produit >> 64);
+#else
+        uint64_t aHaut = p_a >> 32, aBas = p_a & 0xffffffffu, bHaut = p_b >> 32, bBas = p_b & 0xffffffffu;
+        uint64_t basBas = aBas * bBas, hautBas = aHaut * bBas, basHaut = aBas * bHaut, hautHaut = aHaut * bHaut;
+        uint64_t milieu = (basBas >> 32) + (hautBas & 0xffffffffu) + basHaut;
+        uint64_t bas = (milieu << 32) | (basBas & 0xffffffffu);
+        uint64_t haut = hautHaut + (hautBas >> 32) + (milieu >> 32);
+        return bas ^ haut;
+#endif
+    }
+
+/**
+ * \class HString3
+ * \brief Foncteur de hachage rapide pour des string, dans le style de wyhash. Accepte toute chaîne convertible en
+ * std::string_view, avec le même hash pour des chaînes égales.
+ *
+ * Les chaînes de plus de 32 octets sont lues 32 octets par étape, en deux chaînes de calcul indépendantes que le
+ * processeur exécute en parallèle; chaque paire de mots de 8 octets est combinée par melangerProduit. La fin de la
+ * chaîne est lue par deux lectures qui peuvent se chevaucher, sans boucle octet par octet.
+ */
+    class HString3 {
+    public:
+        size_t operator()(std::string_view p_clef) const {
+            const char *p = p_clef.data();
+            size_t n = p_clef.size();
+            uint64_t hash = SECRETS[0] ^ n;
+            if (n > 32) {
+                uint64_t second = hash;
+                do {
+                    hash = melangerProduit(_lire64(p) ^ SECRETS[1], _lire64(p + 8) ^ hash);
+                    second = melangerProduit(_lire64(p + 16) ^ SECRETS[2], _lire64(p + 24) ^ second);
+                    p += 32;
+                    n -= 32;
+                } while (n > 32);
+                hash ^= second;
+            }
+            while (n > 16) {
+                hash = melangerProduit(_lire64(p) ^ SECRETS[1], _lire64(p + 8) ^ hash);
+                p += 16;
+                n -= 16;
+            }
+            uint64_t a = 0, b = 0;
+            if (n >= 8) {
+                a = _lire64(p);
+                b = _lire64(p + n - 8);
+            } else if (n >= 4) {
+                a = _lire32(p);
+                b = _lire32(p + n - 4);
+            } else if (n > 0) {
+                a = (static_cast<uint64_t>(static_cast<unsigned char>(p[0])) << 16) |
+                    (static_cast<uint64_t>(static_cast<unsigned char>(p[n / 2])) << 8) |
+                    static_cast<unsigned char>(p[n - 1]);
+            }
+            hash = melangerProduit(a ^ SECRETS[1], b ^ hash);
+            return static_cast<size_t>(melangerProduit(hash ^ SECRETS[3], p_clef.size() ^ SECRETS[0]));
+        }
+
+    private:
+        static constexpr uint64_t SECRETS[4] = {0xa0761d6478bd642full, 0xe7037ed1a0b428dbull,
+                                                0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull};
+
+        static uint64_t _lire64(const char *p) {
+            uint64_t mot;
+            std::memcpy(&mot, p, sizeof(mot));
+            return mot;
+        }
+
+        static uint64_t _lire32(const char *p) {
+            uint32_t mot;
+            std::memcpy(&mot, p, sizeof(mot));
+            return mot;
+        }
+    };
+
 /**
  * \class HInt1
  * \brief Foncteur de hachage pour des int
@@ -80,71 +195,267 @@ namespace labTableHachage {
         }
     };
 
-    /**
- * @class HacheurQuadStr1
+/**
+ * \class HInt3
+ * \brief Foncteur de hachage pour des int: le mélange final de MurmurHash3 sur 64 bits. Contrairement à HInt1, des
+ * clefs voisines ou en progression arithmétique ont des hash sans relation entre eux, sur les 64 bits.
+ */
+    class HInt3 {
+    public:
+        size_t operator()(const int &p_clef) const {
+            uint64_t total = static_cast<uint32_t>(p_clef);
+            total ^= total >> 33;
+            total *= 0xff51afd7ed558ccdull;
+            total ^= total >> 33;
+            total *= 0xc4ceb9fe1a85ec53ull;
+            total ^= total >> 33;
+            return static_cast<size_t>(total);
+        }
+    };
+
+/**
+ * @class HacheurCompose
  *
  * Objet fonction servant à implanter une fonction de hachage ayant la forme suivante:
  *
- * H(x, i) = ( h(x) + f(i) ) % module où x est une clef à hacher, h(x) est la fonction de hachage primaire, i est le
- * nombre de tentatives de hachage, f(i) est la fonction de rehachage en cas de collision et module est la taille maximale
- * de la table de dispersion.
+ * H(x, i) = ( h(x) + f(i) ) % c où x est une clef à hacher, h(x) est la fonction de hachage primaire HashPrimaire,
+ * préparée par PolitiqueCapacite::preparer, i est le nombre de tentatives de hachage, f(i) est la fonction de
+ * résolution des collisions de PolitiqueSondage (voir PolitiquesSondage.h) et c est la capacité de la table, réduite
+ * par PolitiqueCapacite::reduire.
+ *
+ * Les trois politiques sont des paramètres du template: tous les appels sont résolus à la compilation et peuvent être
+ * insérés dans la boucle de sondage. En plus de primaire(clef) et indice(h, i), le hacheur offre suivant(index, h, i),
+ * qui passe de la position après i - 1 collisions à la suivante par une addition et une comparaison; TableHachage
+ * l'utilise pour ne hacher chaque clef qu'une fois par sondage.
  *
  */
-    class HacheurQuadStr1 : public HString1 {
+    template<class HashPrimaire, class PolitiqueSondage, class PolitiqueCapacite = CapacitePremiere>
+    class HacheurCompose : public HashPrimaire {
     public:
+        static const int COUVERTURE = PolitiqueSondage::COUVERTURE; /*!< Lu par TableHachage, voir CouvertureSondage */
+        typedef PolitiqueCapacite Capacite; /*!< Lu par TableHachage, voir CapaciteHacheur */
+
+        static_assert(!std::is_same<PolitiqueSondage, SondageTriangulaire>::value ||
+                      std::is_same<PolitiqueCapacite, CapacitePuissanceDeux>::value,
+                      "SondageTriangulaire ne visite toutes les positions qu'avec CapacitePuissanceDeux");
+        static_assert(!std::is_same<PolitiqueSondage, SondageQuadratique>::value ||
+                      std::is_same<PolitiqueCapacite, CapacitePremiere>::value,
+                      "SondageQuadratique ne visite la moitié des positions qu'avec CapacitePremiere");
 
         /**
          * @brief Constructeur
-         * @param p_tailleTable La capacité maximale de la table de dispersion
+         * @param p_tailleTable La capacité de la table de dispersion, valide selon PolitiqueCapacite
          */
-
-        HacheurQuadStr1(size_t p_tailleTable) : HString1(), module(p_tailleTable) {}
+        HacheurCompose(size_t p_tailleTable) : HashPrimaire(), m_capacite(p_tailleTable) {
+            PRECONDITION(PolitiqueCapacite::estValide(p_tailleTable));
+        }
 
         /**
          * @brief Fonction de hachage en adressage ouvert
+         * @param p_clef La clef à hacher, de tout type accepté par HashPrimaire
+         * @param p_tentative Le nombre de collisions rencontré
+         * @return Le hash voulu
+         */
+        template<typename ClefCompatible>
+        size_t operator()(const ClefCompatible &p_clef, size_t p_tentative = 0) const {
+            return indice(primaire(p_clef), p_tentative);
+        }
+
+        /**
+         * @brief Fonction de hachage primaire h(x), préparée par la politique de capacité
          * @param p_clef La clef à hacher
+         * @return Le hash primaire de la clef, avant sa réduction à la capacité de la table
+         */
+        template<typename ClefCompatible>
+        size_t primaire(const ClefCompatible &p_clef) const {
+            return PolitiqueCapacite::preparer(HashPrimaire::operator()(p_clef));
+        }
+
+        /**
+         * @brief Calcule H(x, i) à partir du hash primaire déjà calculé
+         * @param p_hash Le hash primaire h(x)
          * @param p_tentative Le nombre de collisions rencontré
          * @return Le hash voulu
          */
-        size_t operator()(const std::string &p_clef, size_t p_tentative = 0) const {
-            return (HString1::operator()(p_clef) + p_tentative * p_tentative) % module;
+        size_t indice(size_t p_hash, size_t p_tentative) const {
+            return _ramener(PolitiqueCapacite::reduire(p_hash, m_capacite) + PolitiqueSondage::decalage(p_tentative));
+        }
+
+        /**
+         * @brief Calcule H(x, i) à partir de H(x, i - 1), sans calculer f(i) ni réduire le hash primaire
+         * @param p_index La position après i - 1 collisions, H(x, i - 1)
+         * @param p_tentative Le nombre de collisions rencontré, i, au moins 1
+         * @return Le hash voulu, égal à indice(h, i)
+         */
+        size_t suivant(size_t p_index, size_t, size_t p_tentative) const {
+            return _ramener(p_index + PolitiqueSondage::pas(p_tentative));
         }
 
     private:
-        size_t module;
+        size_t m_capacite;
+
+        size_t _ramener(size_t p_index) const {
+            return p_index < m_capacite ? p_index : PolitiqueCapacite::reduire(p_index, m_capacite);
+        }
     };
 
-    /**
- * @class HacheurQuadInt1
+    typedef HacheurCompose<HString1, SondageQuadratique> HacheurQuadStr1; /*!< HString1, sondage quadratique */
+    typedef HacheurCompose<HInt1, SondageQuadratique> HacheurQuadInt1; /*!< HInt1, sondage quadratique */
+    typedef HacheurCompose<HString3, SondageQuadratique> HacheurQuadStr3; /*!< HString3, sondage quadratique */
+    typedef HacheurCompose<HInt3, SondageQuadratique> HacheurQuadInt3; /*!< HInt3, sondage quadratique */
+    /*! HString1 mélangé, sondage triangulaire et capacité en puissance de deux */
+    typedef HacheurCompose<HString1, SondageTriangulaire, CapacitePuissanceDeux> HacheurTriangStr1;
+    /*! HInt1 mélangé, sondage triangulaire et capacité en puissance de deux */
+    typedef HacheurCompose<HInt1, SondageTriangulaire, CapacitePuissanceDeux> HacheurTriangInt1;
+
+/**
+ * @class HacheurDouble
  *
- * Objet fonction servant à implanter une fonction de hachage ayant la forme suivante:
+ * Objet fonction servant à implanter le double hachage:
+ *
+ * H(x, i) = ( h1(x) + i * p(x) ) % c où h1(x) est la fonction de hachage primaire HashPrimaire et le pas p(x) est
+ * tiré de la seconde fonction de hachage HashPas, indépendante de la première. Deux clefs de même position initiale
+ * suivent alors des séquences différentes, sans agglutinement.
+ *
+ * Le pas est impair et compris entre 1 et c - 1: il est premier avec une capacité première comme avec une puissance
+ * de deux, et la séquence visite toutes les positions de la table. TableHachage accepte donc un taux de remplissage
+ * de TAUX_MAX = 80 % au lieu de 50 % avec ce hacheur, pour environ 35 % de mémoire en moins à cardinalité égale.
  *
- * H(x, i) = ( h(x) + f(i) ) % module où x est une clef à hacher, h(x) est la fonction de hachage primaire, i est le
- * nombre de tentatives de hachage, f(i) est la fonction de rehachage en cas de collision et module est la taille maximale
- * de la table de dispersion.
+ * primaire(x) réunit les deux hash en un seul size_t: 32 bits pour la position initiale et 32 bits pour le pas. Le
+ * hash conservé par HacheurHashConserve ou calculé une fois par sondage suffit ainsi à toute la séquence; la capacité
+ * doit être inférieure à 2^32.
  *
  */
-    class HacheurQuadInt1 : public HInt1 {
+    template<class HashPrimaire, class HashPas, class PolitiqueCapacite = CapacitePremiere>
+    class HacheurDouble {
     public:
+        static const int TAUX_MAX = 80; /*!< Lu par TableHachage, voir TauxMaxSondage */
+        static const int COUVERTURE = 100; /*!< Lu par TableHachage, voir CouvertureSondage */
+        typedef PolitiqueCapacite Capacite; /*!< Lu par TableHachage, voir CapaciteHacheur */
+
         /**
          * @brief Constructeur
-         * @param p_tailleTable La taille maximale de la table de dispersion
+         * @param p_tailleTable La capacité de la table de dispersion, valide selon PolitiqueCapacite et inférieure
+         * à 2^32
+         */
+        HacheurDouble(size_t p_tailleTable) : m_capacite(p_tailleTable), m_demiCapacite((p_tailleTable - 1) / 2) {
+            PRECONDITION(PolitiqueCapacite::estValide(p_tailleTable));
+            PRECONDITION(p_tailleTable <= 0xffffffffu);
+        }
+
+        /**
+         * @brief Fonction de hachage en adressage ouvert
+         * @param p_clef La clef à hacher
+         * @param p_tentative Le nombre de collisions rencontré
+         * @return Le hash voulu
          */
-        HacheurQuadInt1(size_t p_tailleTable) : HInt1(), module(p_tailleTable) {}
+        template<typename ClefCompatible>
+        size_t operator()(const ClefCompatible &p_clef, size_t p_tentative = 0) const {
+            return indice(primaire(p_clef), p_tentative);
+        }
 
         /**
-         * @brief Surcharge de l'opérateur d'appel. Retourne le résultat H(clef) = ( h(celf) + f(p_tentative) ) % module
+         * @brief Les deux hash de la clef: la position initiale dans les 32 bits faibles, à partir de h1(x) préparé
+         * par la politique de capacité, et le pas dans les 32 bits forts
          * @param p_clef La clef à hacher
-         * @param p_tentative Le nombre de tentatives de hachage
-         * @return Le hash cherché
+         * @return Le hash primaire combiné de la clef
          */
-        size_t operator()(const int &p_clef, size_t p_tentative = 0) const {
-            return (HInt1::operator()(p_clef) + p_tentative * p_tentative) % module;
+        template<typename ClefCompatible>
+        size_t primaire(const ClefCompatible &p_clef) const {
+            uint64_t position = PolitiqueCapacite::preparer(m_hashPrimaire(p_clef));
+            uint64_t pas = m_hashPas(p_clef);
+            return static_cast<size_t>(((position ^ (position >> 32)) & 0xffffffffu) | (pas << 32));
+        }
+
+        /**
+         * @brief Calcule H(x, i) à partir du hash primaire combiné
+         * @param p_hash Le hash primaire combiné, donné par primaire
+         * @param p_tentative Le nombre de collisions rencontré
+         * @return Le hash voulu
+         */
+        size_t indice(size_t p_hash, size_t p_tentative) const {
+            size_t depart = PolitiqueCapacite::reduire(p_hash & 0xffffffffu, m_capacite);
+            return _ramener(depart + (p_tentative % m_capacite) * _pas(p_hash) % m_capacite);
+        }
+
+        /**
+         * @brief Calcule H(x, i) à partir de H(x, i - 1) en ajoutant le pas, sans division
+         * @param p_index La position après i - 1 collisions, H(x, i - 1)
+         * @param p_hash Le hash primaire combiné, donné par primaire
+         * @return Le hash voulu, égal à indice(h, i)
+         */
+        size_t suivant(size_t p_index, size_t p_hash, size_t) const {
+            return _ramener(p_index + _pas(p_hash));
         }
 
     private:
-        size_t module;
+        HashPrimaire m_hashPrimaire;
+        HashPas m_hashPas;
+        size_t m_capacite;
+        size_t m_demiCapacite; /*!< (c - 1) / 2, le nombre de pas impairs possibles */
+
+        /**
+         * @brief Ramène les 32 bits forts du hash dans les entiers impairs de [1, c - 1], par multiplication et
+         * décalage plutôt que par division
+         */
+        size_t _pas(size_t p_hash) const {
+            uint64_t pas = static_cast<uint64_t>(p_hash) >> 32;
+            return 2 * static_cast<size_t>((pas * m_demiCapacite) >> 32) + 1;
+        }
+
+        size_t _ramener(size_t p_index) const {
+            return p_index < m_capacite ? p_index : p_index - m_capacite;
+        }
     };
 
+    typedef HacheurDouble<HString1, HString2> HacheurDoubleStr1; /*!< HString1, pas de HString2 */
+    typedef HacheurDouble<HInt1, HInt2> HacheurDoubleInt1; /*!< HInt1, pas de HInt2 */
+
+/**
+ * @class HacheurHashConserve
+ *
+ * Adaptateur qui demande à TableHachage de conserver dans chaque entrée le hash primaire complet de sa clef. Le
+ * rehachage et le compactage replacent alors les entrées sans rehacher leurs clefs, et le sondage ne compare une clef
+ * qu'aux entrées dont le hash conservé est égal au sien. Chaque entrée grossit d'un size_t: l'option est rentable
+ * lorsque hacher ou comparer les clefs coûte cher, comme pour de longues chaînes.
+ *
+ * Hacheur doit offrir primaire(clef) et indice(h, n).
+ *
+ */
+    template<class Hacheur>
+    class HacheurHashConserve : public Hacheur {
+    public:
+        static const bool CONSERVER_HASH = true; /*!< Lu par TableHachage, voir ConserveHash */
+
+        /**
+         * @brief Constructeur
+         * @param p_tailleTable La capacité de la table de dispersion
+         */
+        HacheurHashConserve(size_t p_tailleTable) : Hacheur(p_tailleTable) {}
+    };
+
+/**
+ * @class HacheurViderParGeneration
+ *
+ * Adaptateur qui demande à TableHachage de vider la table en temps constant. Chaque entrée porte le numéro de la
+ * génération de la table où elle a été écrite, et une entrée d'une génération antérieure est vacante: vider()
+ * incrémente seulement la génération de la table. Les entrées ne sont toutes remises à vacant que lorsque le compteur
+ * de 16 bits revient à zéro, une fois toutes les 65536 vidanges.
+ *
+ * L'option est rentable pour une table de travail, vidée très souvent alors qu'elle ne contient que quelques
+ * éléments. Les clefs et les valeurs d'une entrée vidée ne sont détruites que lorsque l'entrée est réutilisée.
+ *
+ */
+    template<class Hacheur>
+    class HacheurViderParGeneration : public Hacheur {
+    public:
+        static const bool VIDER_PAR_GENERATION = true; /*!< Lu par TableHachage, voir ViderParGeneration */
+
+        /**
+         * @brief Constructeur
+         * @param p_tailleTable La capacité de la table de dispersion
+         */
+        HacheurViderParGeneration(size_t p_tailleTable) : Hacheur(p_tailleTable) {}
+    };
 
 } // Fin namespace
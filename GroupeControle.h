@@ -0,0 +1,150 @@
+/**
+ * \file GroupeControle.h
+ * \brief Comparaison simultanée d'un groupe d'octets de contrôle
+ * \version 0.4
+ * \date octobre 2026
+ *
+ * Les octets de contrôle suivent la convention de TableHachageCompacte: 0x80 pour une entrée vacante, 0xFE pour
+ * une entrée effacée, et une valeur entre 0 et 127 (bit 7 à zéro) pour une entrée occupée.
+ *
+ * Le moteur est choisi à la compilation: AVX2 (groupes de 32 octets) si __AVX2__ est défini, sinon SSE2 (groupes
+ * de 16 octets) si __SSE2__ est défini, sinon une version portable qui traite 8 octets à la fois dans un entier de
+ * 64 bits. Définir TABLEHACHAGE_SANS_SIMD force la version portable.
+ */
+
+#ifndef GROUPECONTROLE_H_
+#define GROUPECONTROLE_H_
+
+#include <cstdint>
+#include <cstring>
+
+#if !defined(TABLEHACHAGE_SANS_SIMD) && defined(__AVX2__)
+#  define TABLEHACHAGE_AVX2
+#  include <immintrin.h>
+#elif !defined(TABLEHACHAGE_SANS_SIMD) && defined(__SSE2__)
+#  define TABLEHACHAGE_SSE2
+#  include <emmintrin.h>
+#endif
+
+namespace labTableHachage {
+
+    /**
+     * @brief Donne l'index du bit le moins significatif à 1
+     * @param p_masque Un masque non nul
+     * @return La position du premier bit à 1
+     */
+    inline unsigned premierBit(uint32_t p_masque) {
+#if defined(__GNUC__)
+        return static_cast<unsigned>(__builtin_ctz(p_masque));
+#else
+        unsigned position = 0;
+        while (!(p_masque & 1u)) {
+            p_masque >>= 1;
+            ++position;
+        }
+        return position;
+#endif
+    }
+
+/**
+ * \class GroupeControle
+ *
+ * \brief Un groupe de LARGEUR octets de contrôle consécutifs, comparés en une seule opération
+ *
+ * Chaque requête retourne un masque dont le bit i est à 1 si l'octet i du groupe satisfait la condition.
+ */
+    class GroupeControle {
+    public:
+
+#if defined(TABLEHACHAGE_AVX2)
+        static const size_t LARGEUR = 32; /*!< Le nombre d'octets de contrôle par groupe */
+
+        explicit GroupeControle(const uint8_t *p_controle) :
+                m_octets(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p_controle))) {}
+
+        uint32_t correspondances(uint8_t p_fragment) const {
+            __m256i cible = _mm256_set1_epi8(static_cast<char>(p_fragment));
+            return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(m_octets, cible)));
+        }
+
+        uint32_t vacantes() const {
+            __m256i vacant = _mm256_set1_epi8(static_cast<char>(0x80));
+            return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(m_octets, vacant)));
+        }
+
+        uint32_t libres() const {
+            return static_cast<uint32_t>(_mm256_movemask_epi8(m_octets));
+        }
+
+    private:
+        __m256i m_octets;
+
+#elif defined(TABLEHACHAGE_SSE2)
+        static const size_t LARGEUR = 16; /*!< Le nombre d'octets de contrôle par groupe */
+
+        explicit GroupeControle(const uint8_t *p_controle) :
+                m_octets(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_controle))) {}
+
+        uint32_t correspondances(uint8_t p_fragment) const {
+            __m128i cible = _mm_set1_epi8(static_cast<char>(p_fragment));
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(m_octets, cible)));
+        }
+
+        uint32_t vacantes() const {
+            __m128i vacant = _mm_set1_epi8(static_cast<char>(0x80));
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(m_octets, vacant)));
+        }
+
+        uint32_t libres() const {
+            return static_cast<uint32_t>(_mm_movemask_epi8(m_octets));
+        }
+
+    private:
+        __m128i m_octets;
+
+#else
+        static const size_t LARGEUR = 16; /*!< Le nombre d'octets de contrôle par groupe */
+
+        explicit GroupeControle(const uint8_t *p_controle) {
+            std::memcpy(m_mots, p_controle, sizeof(m_mots));
+        }
+
+        uint32_t correspondances(uint8_t p_fragment) const {
+            uint64_t cible = UNS * p_fragment;
+            return _masque(_octetsNuls(m_mots[0] ^ cible)) | (_masque(_octetsNuls(m_mots[1] ^ cible)) << 8);
+        }
+
+        uint32_t vacantes() const {
+            uint64_t vacant = UNS * 0x80;
+            return _masque(_octetsNuls(m_mots[0] ^ vacant)) | (_masque(_octetsNuls(m_mots[1] ^ vacant)) << 8);
+        }
+
+        uint32_t libres() const {
+            return _masque(m_mots[0] & HAUTS) | (_masque(m_mots[1] & HAUTS) << 8);
+        }
+
+    private:
+        static const uint64_t UNS = 0x0101010101010101ULL;
+        static const uint64_t HAUTS = 0x8080808080808080ULL;
+
+        /**
+         * @brief Met à 1 le bit haut de chaque octet nul du mot, et à 0 tous les autres bits
+         */
+        static uint64_t _octetsNuls(uint64_t p_mot) {
+            return ~(((p_mot & ~HAUTS) + ~HAUTS) | p_mot) & HAUTS;
+        }
+
+        /**
+         * @brief Regroupe les bits hauts des 8 octets d'un mot (petit-boutiste) en un masque de 8 bits
+         */
+        static uint32_t _masque(uint64_t p_hauts) {
+            return static_cast<uint32_t>(((p_hauts >> 7) * 0x0102040810204080ULL) >> 56);
+        }
+
+        uint64_t m_mots[2];
+#endif
+    };
+
+} //Fin du namespace
+
+#endif
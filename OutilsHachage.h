@@ -0,0 +1,175 @@
+/**
+ * \file OutilsHachage.h
+ * \brief Constantes et fonctions utilitaires communes aux tables de dispersion
+ * \version 0.4
+ * \date octobre 2026
+ */
+
+#ifndef OUTILSHACHAGE_H_
+#define OUTILSHACHAGE_H_
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace labTableHachage {
+
+    /**
+     * @var MAX_TENTATIVES Sert à limiter le nombre de tentatives de rehachage en cas de collision afin d'éviter une
+     * boucle infinie.  Est utilisée dans les méthodes de sondage avec une macro ASSERTION
+     */
+    const size_t MAX_TENTATIVES = 10000;
+
+    /**
+     * @brief Vérifie si un nombre est premier
+     * @param p_entier Le nombre à vérifier
+     * @return true si p_entier est premier
+     */
+    inline bool estPremier(size_t p_entier) {
+        if (p_entier <= 1) {
+            return false;
+        }
+        if (p_entier == 2) {             // le seul nombre premier pair
+            return true;
+        }
+        if (p_entier % 2 == 0) {   // sinon, ce n'est pas un nombre premier
+            return false;
+        }
+
+        size_t divisor = 3;
+        size_t upperLimit = static_cast<size_t>(std::sqrt(static_cast<double>(p_entier)) + 1);
+
+        while (divisor <= upperLimit) {
+            if (p_entier % divisor == 0) {
+                return false;
+            }
+            divisor += 2;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Trouve le nombre premier suivant un nombre donné
+     * @param p_entier Le nombre après lequel on veut trouver un nombre premier
+     * @return Le nombre premier suivant p_entier
+     */
+    inline size_t prochainPremier(size_t p_entier) {
+        if (p_entier % 2 == 0) {
+            p_entier++;
+        }
+        while (!estPremier(p_entier)) {
+            p_entier += 2;
+        }
+        return p_entier;
+    }
+
+    /**
+     * \struct ConserveHash
+     * \brief Vaut true si le foncteur de hachage demande que chaque entrée conserve le hash primaire de sa clef, en
+     * déclarant une constante statique CONSERVER_HASH vraie (voir HacheurHashConserve dans FoncteurHachage.hpp)
+     */
+    template<class FoncteurHachage, class = void>
+    struct ConserveHash : std::false_type {
+    };
+
+    template<class FoncteurHachage>
+    struct ConserveHash<FoncteurHachage, std::void_t<decltype(FoncteurHachage::CONSERVER_HASH)> >
+            : std::integral_constant<bool, FoncteurHachage::CONSERVER_HASH> {
+    };
+
+    /**
+     * \struct ViderParGeneration
+     * \brief Vaut true si le foncteur de hachage demande que la table soit vidée en temps constant, en déclarant une
+     * constante statique VIDER_PAR_GENERATION vraie (voir HacheurViderParGeneration dans FoncteurHachage.hpp)
+     */
+    template<class FoncteurHachage, class = void>
+    struct ViderParGeneration : std::false_type {
+    };
+
+    template<class FoncteurHachage>
+    struct ViderParGeneration<FoncteurHachage, std::void_t<decltype(FoncteurHachage::VIDER_PAR_GENERATION)> >
+            : std::integral_constant<bool, FoncteurHachage::VIDER_PAR_GENERATION> {
+    };
+
+    /**
+     * \struct TauxMaxSondage
+     * \brief Le taux de remplissage maximum, en pourcentage, que la séquence de sondage du foncteur de hachage
+     * supporte: la constante statique TAUX_MAX du foncteur s'il en déclare une (voir HacheurDouble dans
+     * FoncteurHachage.hpp), sinon 50, la limite du sondage quadratique sur une capacité première
+     */
+    template<class FoncteurHachage, class = void>
+    struct TauxMaxSondage : std::integral_constant<int, 50> {
+    };
+
+    template<class FoncteurHachage>
+    struct TauxMaxSondage<FoncteurHachage, std::void_t<decltype(FoncteurHachage::TAUX_MAX)> >
+            : std::integral_constant<int, FoncteurHachage::TAUX_MAX> {
+    };
+
+    /**
+     * \struct CouvertureSondage
+     * \brief Le pourcentage des positions de la table que la séquence de sondage du foncteur de hachage visite à coup
+     * sûr: la constante statique COUVERTURE du foncteur s'il en déclare une (voir PolitiquesSondage.h), sinon 50, celle
+     * du sondage quadratique sur une capacité première. Les entrées occupées et effacées ne doivent pas dépasser ce
+     * taux, pour que tout sondage rencontre une position vacante.
+     */
+    template<class FoncteurHachage, class = void>
+    struct CouvertureSondage : std::integral_constant<int, 50> {
+    };
+
+    template<class FoncteurHachage>
+    struct CouvertureSondage<FoncteurHachage, std::void_t<decltype(FoncteurHachage::COUVERTURE)> >
+            : std::integral_constant<int, FoncteurHachage::COUVERTURE> {
+    };
+
+    /**
+     * \struct SondageIncremental
+     * \brief Vaut true si le foncteur de hachage offre suivant(index, h, n), qui calcule une position de la séquence de
+     * sondage à partir de la précédente (voir HacheurCompose dans FoncteurHachage.hpp)
+     */
+    template<class FoncteurHachage, class = void>
+    struct SondageIncremental : std::false_type {
+    };
+
+    template<class FoncteurHachage>
+    struct SondageIncremental<FoncteurHachage, std::void_t<decltype(std::declval<const FoncteurHachage &>().suivant(
+            size_t(), size_t(), size_t()))> > : std::true_type {
+    };
+
+    /**
+     * @brief Construit un objet à partir de ses arguments, en lui transmettant en dernier l'allocateur donné s'il en
+     * accepte un (std::uses_allocator), comme une std::pmr::string avec un std::pmr::polymorphic_allocator
+     * @tparam Type Le type de l'objet à construire
+     * @tparam Allocateur Le type de l'allocateur
+     * @param p_allocateur L'allocateur à transmettre à l'objet
+     * @param p_args Les arguments du constructeur de l'objet, sans l'allocateur
+     * @return L'objet construit
+     */
+    template<typename Type, class Allocateur, typename... Args>
+    Type construireAvecAllocateur(const Allocateur &p_allocateur, Args &&... p_args) {
+        if constexpr (std::uses_allocator<Type, Allocateur>::value) {
+            return Type(std::forward<Args>(p_args)..., p_allocateur);
+        } else {
+            (void) p_allocateur;
+            return Type(std::forward<Args>(p_args)...);
+        }
+    }
+
+    /**
+     * @brief Demande au processeur de charger en cache la ligne d'une adresse, sans attendre qu'elle arrive. Ne fait
+     * rien hors de GCC et Clang.
+     * @param p_adresse L'adresse qui sera bientôt lue
+     */
+    inline void precharger(const void *p_adresse) {
+#if defined(__GNUC__)
+        __builtin_prefetch(p_adresse);
+#else
+        (void) p_adresse;
+#endif
+    }
+
+} //Fin du namespace
+
+#endif
@@ -0,0 +1,121 @@
+/**
+ * \file PolitiquesCapacite.h
+ * \brief Politiques de capacité des tables de dispersion
+ * \version 0.4
+ * \date octobre 2026
+ *
+ * Une politique de capacité a les spécifications suivantes:
+ *
+ * capacite(n): la plus petite capacité valide supérieure ou égale à n
+ * agrandir(c): la capacité valide suivante lorsque la table de capacité c doit grandir
+ * preparer(h): transforme le hash primaire h avant sa réduction, une seule fois par clef
+ * reduire(h, c): ramène h dans l'intervalle [0, c)
+ * estValide(c): true si c est une capacité que reduire accepte
+ *
+ * Le foncteur de hachage d'une table doit réduire ses index de la même façon que la politique de capacité de la
+ * table.
+ */
+
+#ifndef POLITIQUESCAPACITE_H_
+#define POLITIQUESCAPACITE_H_
+
+#include <cstdint>
+#include <type_traits>
+#include "OutilsHachage.h"
+
+namespace labTableHachage {
+
+/**
+ * \class CapacitePremiere
+ * \brief Capacités premières et réduction modulo la capacité. C'est la politique d'origine de TableHachage.
+ */
+    class CapacitePremiere {
+    public:
+        static size_t capacite(size_t p_n) {
+            return prochainPremier(p_n);
+        }
+
+        static size_t agrandir(size_t p_capacite) {
+            return prochainPremier(2 * p_capacite);
+        }
+
+        static size_t preparer(size_t p_hash) {
+            return p_hash;
+        }
+
+        static size_t reduire(size_t p_hash, size_t p_capacite) {
+            return p_hash % p_capacite;
+        }
+
+        static bool estValide(size_t p_capacite) {
+            return p_capacite != 0;
+        }
+    };
+
+/**
+ * \class CapacitePuissanceDeux
+ * \brief Capacités en puissances de deux et réduction par masque, sans division.
+ *
+ * Le masque ne garde que les bits faibles du hash: preparer() les mélange donc à tous les bits du hash primaire
+ * (finaliseur de MurmurHash3), pour que des hashs primaires faibles comme HInt1 ne s'agglutinent pas.
+ */
+    class CapacitePuissanceDeux {
+    public:
+        static size_t capacite(size_t p_n) {
+            size_t capacite = 8;
+            while (capacite < p_n) capacite <<= 1;
+            return capacite;
+        }
+
+        static size_t agrandir(size_t p_capacite) {
+            return 2 * p_capacite;
+        }
+
+        static size_t preparer(size_t p_hash) {
+            uint64_t melange = p_hash;
+            melange ^= melange >> 33;
+            melange *= 0xff51afd7ed558ccdULL;
+            melange ^= melange >> 33;
+            melange *= 0xc4ceb9fe1a85ec53ULL;
+            melange ^= melange >> 33;
+            return static_cast<size_t>(melange);
+        }
+
+        static size_t reduire(size_t p_hash, size_t p_capacite) {
+            return p_hash & (p_capacite - 1);
+        }
+
+        static bool estValide(size_t p_capacite) {
+            return p_capacite != 0 && (p_capacite & (p_capacite - 1)) == 0;
+        }
+    };
+
+/**
+ * \struct CapaciteHacheur
+ * \brief La politique de capacité selon laquelle le foncteur de hachage réduit ses index: le typedef Capacite du
+ * foncteur s'il en déclare un (voir HacheurCompose et HacheurDouble dans FoncteurHachage.hpp), sinon Defaut. C'est la
+ * politique de capacité par défaut des tables, qui rejettent à la compilation toute autre politique.
+ */
+    template<class FoncteurHachage, class Defaut = CapacitePremiere, class = void>
+    struct CapaciteHacheur {
+        typedef Defaut type;
+    };
+
+    template<class FoncteurHachage, class Defaut>
+    struct CapaciteHacheur<FoncteurHachage, Defaut, std::void_t<typename FoncteurHachage::Capacite> > {
+        typedef typename FoncteurHachage::Capacite type;
+    };
+
+/**
+ * \struct CapaciteCompatible
+ * \brief Vaut true si la politique de capacité d'une table est celle du foncteur de hachage, ou si le foncteur n'en
+ * déclare aucune
+ */
+    template<class FoncteurHachage, class PolitiqueCapacite>
+    struct CapaciteCompatible
+            : std::is_same<PolitiqueCapacite, typename CapaciteHacheur<FoncteurHachage, PolitiqueCapacite>::type> {
+    };
+
+} //Fin du namespace
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ * \file PolitiquesSondage.h
+ * \brief Politiques de sondage des tables de dispersion en adressage ouvert
+ * \version 0.4
+ * \date octobre 2026
+ *
+ * Une politique de sondage donne la fonction de résolution des collisions f(i) de H(x, i) = ( h(x) + f(i) ) % c, et
+ * a les spécifications suivantes:
+ *
+ * decalage(i): f(i), le décalage de la position après i collisions par rapport à la position initiale, avec f(0) = 0
+ * pas(i): f(i) - f(i - 1), pour passer de la position après i - 1 collisions à la suivante sans calculer f(i)
+ * COUVERTURE: le pourcentage des positions d'une table de capacité valide que la séquence visite à coup sûr. Il ne
+ * vaut qu'avec la politique de capacité indiquée par la politique de sondage, ce que HacheurCompose vérifie.
+ *
+ * Voir HacheurCompose dans FoncteurHachage.hpp, qui compose une politique de sondage avec un hash primaire et une
+ * politique de capacité.
+ */
+
+#ifndef POLITIQUESSONDAGE_H_
+#define POLITIQUESSONDAGE_H_
+
+#include <cstddef>
+
+namespace labTableHachage {
+
+/**
+ * \class SondageLineaire
+ * \brief f(i) = i: les positions voisines sont sondées une à une, au plus près dans le cache, mais les clefs de
+ * positions initiales voisines s'agglutinent. À réserver aux hash primaires bien mélangés.
+ */
+    class SondageLineaire {
+    public:
+        static const int COUVERTURE = 100;
+
+        static size_t decalage(size_t p_tentative) {
+            return p_tentative;
+        }
+
+        static size_t pas(size_t) {
+            return 1;
+        }
+    };
+
+/**
+ * \class SondageQuadratique
+ * \brief f(i) = i², le sondage d'origine des HacheurQuad*. Avec une capacité première et un taux de remplissage d'au
+ * plus 50 %, une position libre est toujours trouvée. Exige CapacitePremiere.
+ */
+    class SondageQuadratique {
+    public:
+        static const int COUVERTURE = 50; /*!< Les (c + 1) / 2 premières positions sondées sont distinctes */
+
+        static size_t decalage(size_t p_tentative) {
+            return p_tentative * p_tentative;
+        }
+
+        static size_t pas(size_t p_tentative) {
+            return 2 * p_tentative - 1;
+        }
+    };
+
+/**
+ * \class SondageTriangulaire
+ * \brief f(i) = i(i+1)/2. Avec une capacité en puissance de deux, la séquence visite toutes les positions de la
+ * table. Exige CapacitePuissanceDeux: sur une capacité première, elle n'en visite que la moitié.
+ */
+    class SondageTriangulaire {
+    public:
+        static const int COUVERTURE = 100;
+
+        static size_t decalage(size_t p_tentative) {
+            return p_tentative * (p_tentative + 1) / 2;
+        }
+
+        static size_t pas(size_t p_tentative) {
+            return p_tentative;
+        }
+    };
+
+} //Fin du namespace
+
+#endif
@@ -13,15 +13,71 @@
 #ifndef TABLEHACHAGE_H_
 #define TABLEHACHAGE_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
 #include <vector>
+#include <utility>
+#include "OutilsHachage.h"
+#include "PolitiquesCapacite.h"
 
 namespace labTableHachage {
 
-    /**
-     * @var MAX_TENTATIVES Sert à limiter le nombre de tentatives de rehachage en cas de collision afin d'éviter une
-     * boucle infinie.  Est utilisée dans _trouverPositionLibre et _trouverPositionClef avec une macro ASSERTION
-     */
-    const size_t MAX_TENTATIVES = 10000;
+/**
+ * \class HashEntree
+ *
+ * \brief Base d'une entrée de TableHachage, qui conserve le hash primaire de la clef seulement si Conserver est vrai.
+ * Sans hash conservé, la base est vide et n'agrandit pas l'entrée.
+ */
+    template<bool Conserver>
+    class HashEntree {
+    public:
+        size_t reqHash() const { return 0; }
+
+        void asgHash(size_t) {}
+
+        bool memeHash(size_t) const { return true; }
+    };
+
+    template<>
+    class HashEntree<true> {
+    public:
+        size_t reqHash() const { return m_hash; }
+
+        void asgHash(size_t p_hash) { m_hash = p_hash; }
+
+        bool memeHash(size_t p_hash) const { return m_hash == p_hash; }
+
+    private:
+        size_t m_hash = 0; /*!< le hash primaire de la clef de l'entrée */
+    };
+
+/**
+ * \class GenerationEntree
+ *
+ * \brief Base d'une entrée de TableHachage, qui porte la génération de la table où l'entrée a été écrite seulement si
+ * Vider est vrai. Sans génération, la base est vide et toute entrée est de la génération courante.
+ */
+    template<bool Vider>
+    class GenerationEntree {
+    public:
+        void asgGeneration(uint16_t) {}
+
+        bool estCourante(uint16_t) const { return true; }
+    };
+
+    template<>
+    class GenerationEntree<true> {
+    public:
+        void asgGeneration(uint16_t p_generation) { m_generation = p_generation; }
+
+        bool estCourante(uint16_t p_generation) const { return m_generation == p_generation; }
+
+    private:
+        uint16_t m_generation = 0; /*!< la génération de la table où l'entrée a été écrite */
+    };
 
 /**
  * \class TableHachage
@@ -35,35 +91,236 @@ namespace labTableHachage {
  * TypeElement : le type des éléments
  * FoncteurHachage: foncteur de hachage. Celui-ci prend en charge la hachage avec résolution des collisions par adressage
  * ouvert.  Voir la spécification complète dans la documentation de FoncteurHachage.hpp
+ * PolitiqueCapacite: choix des capacités de la table (CapacitePremiere ou CapacitePuissanceDeux). Par défaut, celle du
+ * foncteur de hachage (voir CapaciteHacheur); une autre politique est rejetée à la compilation. Voir
+ * PolitiquesCapacite.h
+ *
+ * Les recherches et les retraits acceptent aussi une clef d'un type compatible avec TypeClef, sans construire de
+ * TypeClef temporaire: le type doit être comparable à TypeClef par == et accepté par le foncteur de hachage, qui doit
+ * lui donner le même hash qu'à la TypeClef égale. Par exemple, const char * et std::string_view pour des clefs
+ * std::string avec HacheurQuadStr1.
+ *
+ * Le taux de remplissage maximum, le taux minimum sous lequel les retraits réduisent la table et le facteur
+ * d'agrandissement des rehachages se règlent par table: voir asgTauxMax, asgTauxMin et asgFacteurCroissance.
+ *
+ * Si FoncteurHachage offre suivant(index, h, n), comme HacheurCompose, chaque clef n'est hachée qu'une fois par
+ * séquence de sondage et chaque position suivante est calculée à partir de la précédente.
+ *
+ * Si FoncteurHachage est un HacheurViderParGeneration, vider() est en temps constant: voir GenerationEntree.
+ *
+ * Si FoncteurHachage est un HacheurHashConserve, chaque entrée conserve le hash primaire de sa clef: le rehachage et
+ * le compactage ne rehachent aucune clef, et le sondage ne compare que les clefs dont le hash conservé est égal.
+ *
+ * Allocateur: l'allocateur du tableau des entrées, std::allocator par défaut. Il est transmis aux clefs et aux
+ * éléments qui acceptent un allocateur (std::uses_allocator), ce qui est le cas avec std::pmr::polymorphic_allocator:
+ * voir pmr::TableHachage. En mode arène, une pmr::TableHachage sur un std::pmr::monotonic_buffer_resource ne fait
+ * qu'avancer dans les blocs de la ressource pour chaque entrée et chaque clef std::pmr::string longue; les
+ * désallocations ne font rien et la mémoire est libérée d'un coup à la destruction de la ressource. Les tableaux
+ * abandonnés par les rehachages y restent jusque-là: réserver la capacité d'avance.
  */
 
-    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage,
+            class PolitiqueCapacite = typename CapaciteHacheur<FoncteurHachage>::type,
+            class Allocateur = std::allocator<std::pair<const TypeClef, TypeElement> > >
     class TableHachage {
+        class EntreeHachage;
+
+        static_assert(CapaciteCompatible<FoncteurHachage, PolitiqueCapacite>::value,
+                      "PolitiqueCapacite doit être celle du foncteur de hachage");
+
     public:
 
-        TableHachage(size_t = 100);
+        /**
+         * \class IterateurTable
+         *
+         * \brief Itérateur avant sur les paires clef-valeur de la table, qui saute les entrées non occupées
+         *
+         * operator* retourne une paire de références sur la clef et la valeur de l'entrée courante. Les itérateurs sont
+         * invalidés par toute insertion ou tout retrait, qui peuvent rehacher ou compacter la table.
+         */
+        template<typename Entree, typename Element>
+        class IterateurTable {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef std::pair<const TypeClef &, Element &> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef value_type reference;
+            typedef void pointer;
+
+            IterateurTable() : m_courante(nullptr), m_fin(nullptr), m_generation(0) {
+            }
+
+            IterateurTable(Entree *p_courante, Entree *p_fin, uint16_t p_generation) :
+                    m_courante(p_courante), m_fin(p_fin), m_generation(p_generation) {
+                _sauterInoccupees();
+            }
+
+            /**
+             *  \brief Conversion d'un Iterateur en IterateurConstant
+             */
+            template<typename AutreEntree, typename AutreElement>
+            IterateurTable(const IterateurTable<AutreEntree, AutreElement> &p_source) :
+                    m_courante(p_source.m_courante), m_fin(p_source.m_fin), m_generation(p_source.m_generation) {
+            }
+
+            const TypeClef &clef() const {
+                return m_courante->m_clef;
+            }
+
+            Element &element() const {
+                return m_courante->m_el;
+            }
+
+            reference operator*() const {
+                return reference(m_courante->m_clef, m_courante->m_el);
+            }
+
+            IterateurTable &operator++() {
+                ++m_courante;
+                _sauterInoccupees();
+                return *this;
+            }
+
+            IterateurTable operator++(int) {
+                IterateurTable copie(*this);
+                ++*this;
+                return copie;
+            }
+
+            bool operator==(const IterateurTable &p_autre) const {
+                return m_courante == p_autre.m_courante;
+            }
+
+            bool operator!=(const IterateurTable &p_autre) const {
+                return m_courante != p_autre.m_courante;
+            }
+
+        private:
+            template<typename, typename> friend class IterateurTable;
+
+            void _sauterInoccupees() {
+                while (m_courante != m_fin &&
+                       (m_courante->m_info != OCCUPE || !m_courante->estCourante(m_generation))) {
+                    ++m_courante;
+                }
+            }
+
+            Entree *m_courante; /*!< l'entrée courante, ou m_fin */
+            Entree *m_fin; /*!< la fin du tableau des entrées */
+            uint16_t m_generation; /*!< la génération de la table, voir GenerationEntree */
+        };
+
+        typedef IterateurTable<EntreeHachage, TypeElement> Iterateur;
+        typedef IterateurTable<const EntreeHachage, const TypeElement> IterateurConstant;
+
+        typedef Allocateur allocator_type;
+
+        TableHachage(size_t = 100, const Allocateur & = Allocateur());
+
+        explicit TableHachage(const Allocateur &);
+
+        template<typename IterateurPaires,
+                typename = typename std::iterator_traits<IterateurPaires>::value_type::first_type>
+        TableHachage(IterateurPaires, IterateurPaires, const Allocateur & = Allocateur());
 
         void inserer(const TypeClef &, const TypeElement &);
 
-        void enlever(const TypeClef &);
+        void inserer(TypeClef &&, TypeElement &&);
+
+        template<typename IterateurPaires,
+                typename = typename std::iterator_traits<IterateurPaires>::value_type::first_type>
+        void inserer(IterateurPaires, IterateurPaires);
+
+        template<typename ClefCompatible>
+        void enlever(const ClefCompatible &);
+
+        template<typename ClefCompatible>
+        bool contient(const ClefCompatible &) const;
+
+        template<typename ClefCompatible>
+        const TypeElement &element(const ClefCompatible &) const;
+
+        template<typename ClefCompatible>
+        TypeElement &element(const ClefCompatible &);
+
+        template<typename ClefCompatible>
+        TypeElement *trouver(const ClefCompatible &);
+
+        template<typename ClefCompatible>
+        const TypeElement *trouver(const ClefCompatible &) const;
+
+        template<typename ClefCompatible>
+        void contientLot(const ClefCompatible *, size_t, bool *) const;
+
+        template<typename ClefCompatible>
+        void trouverLot(const ClefCompatible *, size_t, const TypeElement **) const;
+
+        bool insererOuAssigner(const TypeClef &, const TypeElement &);
+
+        std::pair<TypeElement *, bool> insererSiAbsent(const TypeClef &, const TypeElement &);
+
+        template<typename... Args>
+        std::pair<TypeElement *, bool> emplacer(const TypeClef &, Args &&...);
+
+        template<typename... Args>
+        std::pair<TypeElement *, bool> emplacer(TypeClef &&, Args &&...);
+
+        TypeElement &operator[](const TypeClef &);
+
+        TypeElement &operator[](TypeClef &&);
 
-        bool contient(const TypeClef &) const;
+        Iterateur begin();
 
-        TypeElement element(const TypeClef &) const;
+        Iterateur end();
+
+        IterateurConstant begin() const;
+
+        IterateurConstant end() const;
 
         void rehacher();
 
+        void reserver(size_t);
+
         void vider();
 
         int taille() const;
 
+        size_t capacite() const;
+
         double statistiques() const;
 
+        size_t nombreEffaces() const;
+
+        unsigned long nombreCompactages() const;
+
+        size_t reqFilsRehachage() const;
+
+        void asgFilsRehachage(size_t);
+
+        int reqTauxMax() const;
+
+        void asgTauxMax(int);
+
+        int reqTauxMin() const;
+
+        void asgTauxMin(int);
+
+        double reqFacteurCroissance() const;
+
+        void asgFacteurCroissance(double);
+
+        void ajusterCapacite();
+
         void afficher(std::ostream &) const;
 
-        template<typename TClef, typename TElement, class FHachage>
+        Allocateur reqAllocateur() const;
+
+        template<typename TClef, typename TElement, class FHachage, class PCapacite, class A>
         friend std::ostream &operator<<(std::ostream &,
-                                        const TableHachage<TClef, TElement, FHachage> &);
+                                        const TableHachage<TClef, TElement, FHachage, PCapacite, A> &);
+
+        template<typename TClef, typename TElement, class FHachage, class PCapacite>
+        friend class TableHachageIncrementale;
 
     private:
 
@@ -74,21 +331,32 @@ namespace labTableHachage {
         enum EtatEntree {
             OCCUPE, /*!< l'entrée est occupée*/
             VACANT, /*!< l'entrée n'a jamais été utilisé*/
-            EFFACE /*!< l'entrée a été utilisée mais ne l'est plus actuellement*/
+            EFFACE, /*!< l'entrée a été utilisée mais ne l'est plus actuellement*/
+            A_REPLACER /*!< l'entrée est occupée et attend d'être replacée par un compactage en cours*/
         };
 
+        static const bool CONSERVER_HASH = ConserveHash<FoncteurHachage>::value; /*!< Voir HacheurHashConserve */
+        static const bool SONDAGE_INCREMENTAL = SondageIncremental<FoncteurHachage>::value; /*!< Voir HacheurCompose */
+        /*! Voir HacheurViderParGeneration */
+        static const bool VIDER_PAR_GENERATION = ViderParGeneration<FoncteurHachage>::value;
+        /*! L'allocateur des entrées, obtenu de Allocateur */
+        typedef typename std::allocator_traits<Allocateur>::template rebind_alloc<EntreeHachage> AllocateurEntree;
+        typedef std::vector<EntreeHachage, AllocateurEntree> Tableau; /*!< Le tableau des entrées */
+
         /**
          * \class EntreeHachage
          *
          * \brief Classe interne pour définir une entrée dans la table
          *
          */
-        class EntreeHachage {
+        class EntreeHachage : public HashEntree<CONSERVER_HASH>, public GenerationEntree<VIDER_PAR_GENERATION> {
         public:
             TypeClef m_clef; /*!< la clé de hachage*/
             TypeElement m_el; /*!< la valeur associée à la clé*/
             EtatEntree m_info; /*!< tag pour préciser l'état de l'entrée */
 
+            typedef AllocateurEntree allocator_type; /*!< Transmis par le tableau, voir std::uses_allocator */
+
             /**
              *  \brief Constructeur par défaut
              */
@@ -96,6 +364,35 @@ namespace labTableHachage {
                     m_info(VACANT) {
             }
 
+            /**
+             *  \brief Constructeur d'une entrée vacante dont la clef et la valeur utilisent l'allocateur, s'il y a lieu
+             */
+            explicit EntreeHachage(const allocator_type &p_allocateur) :
+                    m_clef(construireAvecAllocateur<TypeClef>(p_allocateur)),
+                    m_el(construireAvecAllocateur<TypeElement>(p_allocateur)), m_info(VACANT) {
+            }
+
+            /**
+             *  \brief Constructeurs de copie et de déplacement dont la clef et la valeur utilisent l'allocateur
+             */
+            EntreeHachage(const EntreeHachage &p_source, const allocator_type &p_allocateur) :
+                    EntreeHachage(p_allocateur) {
+                *this = p_source;
+            }
+
+            EntreeHachage(EntreeHachage &&p_source, const allocator_type &p_allocateur) :
+                    EntreeHachage(p_allocateur) {
+                *this = std::move(p_source);
+            }
+
+            EntreeHachage(const EntreeHachage &) = default;
+
+            EntreeHachage(EntreeHachage &&) = default;
+
+            EntreeHachage &operator=(const EntreeHachage &) = default;
+
+            EntreeHachage &operator=(EntreeHachage &&) = default;
+
             /**
              *  \brief Constructeur avec argument pour initialiser les membres de la classe
              */
@@ -114,41 +411,105 @@ namespace labTableHachage {
             }
         };
 
+        /**
+         * \struct ResultatSondage
+         *
+         * \brief Résultat d'une seule séquence de sondage pour une clef
+         *
+         * Si la clef est présente, index pointe sur son entrée. Sinon, index pointe sur la première position libre
+         * (effacée ou vacante) de la séquence, soit l'endroit où la clef serait insérée.
+         */
+        struct ResultatSondage {
+            size_t index; /*!< la position de la clef, ou la position où l'insérer */
+            bool trouvee; /*!< true si la clef est présente à index */
+            size_t collisions; /*!< le nombre d'entrées occupées rencontrées avant la position libre */
+            size_t hash; /*!< le hash primaire de la clef si CONSERVER_HASH ou SONDAGE_INCREMENTAL, sinon 0 */
+        };
+
         // Attributs
 
         size_t m_tailleTable;
-        std::vector<EntreeHachage> m_tab; /*!< La table de hachage */
+        Tableau m_tab; /*!< La table de hachage */
         size_t m_cardinalite; /*!< Le nombre d'éléments actifs dans la table */
-        static const int TAUX_MAX = 50; /*!< Taux de remplissage maximum dans la table */
+        size_t m_nEffaces; /*!< Le nombre d'entrées effacées dans la table */
+        uint16_t m_generation; /*!< La génération courante si VIDER_PAR_GENERATION, sinon 0 */
+        /*! Taux de remplissage supporté par le sondage: 50 %, ou plus s'il visite toutes les positions */
+        static const int TAUX_MAX = TauxMaxSondage<FoncteurHachage>::value;
+        /*! Taux des positions que le sondage visite à coup sûr: 50 % pour le sondage quadratique */
+        static const int COUVERTURE = CouvertureSondage<FoncteurHachage>::value;
+        int m_tauxMax; /*!< Taux de remplissage maximum dans la table, au plus TAUX_MAX */
+        int m_tauxMin; /*!< Taux de remplissage sous lequel un retrait réduit la table, 0 pour ne jamais la réduire */
+        double m_facteurCroissance; /*!< Facteur d'agrandissement de la capacité d'un rehachage, 2 par défaut */
         FoncteurHachage m_hachage; /*!< Foncteur de hachage */
 
         unsigned long m_nInsertions /*!< Nombre d'insertions au total*/;
         unsigned long m_nCollisions; /*!< Le nombre de collisions au total*/
+        unsigned long m_nCompactages; /*!< Le nombre de compactages des entrées effacées au total*/
+        size_t m_nFilsRehachage; /*!< Le nombre de fils qui se partagent un rehachage, 1 par défaut */
+        static const size_t TAILLE_GROUPE_LOT = 16; /*!< Nombre de clefs d'un lot préchargées ensemble */
+        static const size_t SEUIL_REHACHAGE_PARALLELE = 1 << 16; /*!< Capacité minimale d'un rehachage parallèle */
 
         // Méthodes privées
 
-        static int _prochainPremier(int);
+        template<typename ClefCompatible>
+        ResultatSondage _sonder(const ClefCompatible &) const;
+
+        template<typename ClefCompatible>
+        ResultatSondage _sonder(const ClefCompatible &, size_t, size_t) const;
+
+        template<typename ClefCompatible>
+        size_t _hashPrimaire(const ClefCompatible &) const;
+
+        size_t _hashEntree(const EntreeHachage &) const;
+
+        template<typename ClefCompatible>
+        size_t _indice(const ClefCompatible &, size_t, size_t) const;
 
-        static bool _estPremier(int);
+        template<typename ClefCompatible>
+        size_t _suivant(const ClefCompatible &, size_t, size_t, size_t) const;
 
-        size_t _trouverPositionLibre(const TypeClef &);
+        template<typename ClefCompatible, typename Traitement>
+        void _sonderLot(const ClefCompatible *, size_t, Traitement) const;
 
-        size_t _trouverPositionClef(const TypeClef &) const;
+        ResultatSondage _sonderPositionLibre(const TypeClef &, size_t) const;
+
+        template<typename C, typename... Args>
+        size_t _placer(ResultatSondage, C &&, Args &&...);
 
         bool _doitEtreRehachee() const;
 
+        bool _doitEtreCompactee(size_t) const;
+
+        bool _doitEtreReduite() const;
+
+        void _compacter();
+
+        EtatEntree _etat(const EntreeHachage &) const;
+
         bool _estVacante(size_t) const;
 
         bool _estEffacee(size_t) const;
 
         bool _estOccupee(size_t) const;
 
-        void _reqEntreesActives(std::vector<EntreeHachage> &) const;
+        void _rehacher(size_t);
+
+        void _replacerParallele(Tableau &);
 
-        void _redimensionner();
+        void _redimensionner(size_t);
+
+        static size_t _capaciteRequise(size_t, int);
 
         void _statistiques(const unsigned long &);
     };
+    namespace pmr {
+        /*! TableHachage dont le tableau, les clefs et les éléments utilisent une std::pmr::memory_resource */
+        template<typename TypeClef, typename TypeElement, class FoncteurHachage,
+                class PolitiqueCapacite = typename CapaciteHacheur<FoncteurHachage>::type>
+        using TableHachage = labTableHachage::TableHachage<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite,
+                std::pmr::polymorphic_allocator<std::pair<const TypeClef, TypeElement> > >;
+    }
+
 } //Fin du namespace
 
 #include "TableHachage.hpp"
@@ -1,7 +1,13 @@
-#include <cmath>
 #include "ContratException.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <thread>
 #include <vector>
 #include <stdexcept>
+#include <utility>
 
 namespace labTableHachage {
 
@@ -10,34 +16,118 @@ namespace labTableHachage {
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam Hacheur Doit être un objet-fonction Hacheur tel que décrit dans la documentation de FoncteurHachage.cpp
+     * @tparam PolitiqueCapacite La politique de capacité, voir PolitiquesCapacite.h
+     * @tparam Allocateur L'allocateur du tableau des entrées, transmis aux clefs et aux éléments qui l'acceptent
      * @param n La cardinalité approximative du vecteur contenant la table de dispersion.  Cette cardinalité sera en fait
-     * le nombre premier suivant n.
+     * la capacité valide suivant n selon PolitiqueCapacite (le nombre premier suivant n par défaut).
+     * @param allocateur L'allocateur de la table
      */
-    template<typename TypeClef, typename TypeElement, class Hacheur>
-    TableHachage<TypeClef, TypeElement, Hacheur>::TableHachage(size_t n) :
-            m_tailleTable(_prochainPremier(n)),
-            m_tab(std::vector<EntreeHachage>(m_tailleTable)),
+    template<typename TypeClef, typename TypeElement, class Hacheur, class PolitiqueCapacite, class Allocateur>
+    TableHachage<TypeClef, TypeElement, Hacheur, PolitiqueCapacite, Allocateur>::TableHachage(
+            size_t n, const Allocateur &allocateur) :
+            m_tailleTable(PolitiqueCapacite::capacite(n)),
+            m_tab(m_tailleTable, AllocateurEntree(allocateur)),
             m_cardinalite(0),
+            m_nEffaces(0),
+            m_generation(0),
+            m_tauxMax(TAUX_MAX), m_tauxMin(0), m_facteurCroissance(2),
             m_hachage(m_tailleTable),
-            m_nInsertions(0), m_nCollisions(0) {}
+            m_nInsertions(0), m_nCollisions(0), m_nCompactages(0),
+            m_nFilsRehachage(1) {}
+
+    /**
+     * @brief Constructeur à partir d'une plage de paires clef-valeur. La table est dimensionnée une seule fois pour
+     * contenir toutes les paires sans rehachage.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam Hacheur
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam IterateurPaires Un itérateur avant sur des paires dont first est la clef et second la valeur
+     * @param debut Le début de la plage
+     * @param fin La fin de la plage
+     * @param allocateur L'allocateur de la table
+     * @except PreconditionException si une clef apparaît plus d'une fois dans la plage
+     */
+    template<typename TypeClef, typename TypeElement, class Hacheur, class PolitiqueCapacite, class Allocateur>
+    template<typename IterateurPaires, typename>
+    TableHachage<TypeClef, TypeElement, Hacheur, PolitiqueCapacite, Allocateur>::TableHachage(
+            IterateurPaires debut, IterateurPaires fin, const Allocateur &allocateur) :
+            TableHachage(_capaciteRequise(std::distance(debut, fin), TAUX_MAX), allocateur) {
+        inserer(debut, fin);
+    }
+
+    /**
+     * @brief Constructeur d'une table de capacité par défaut qui utilise un allocateur, par exemple une
+     * std::pmr::memory_resource pour une pmr::TableHachage
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam Hacheur
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param allocateur L'allocateur de la table
+     */
+    template<typename TypeClef, typename TypeElement, class Hacheur, class PolitiqueCapacite, class Allocateur>
+    TableHachage<TypeClef, TypeElement, Hacheur, PolitiqueCapacite, Allocateur>::TableHachage(
+            const Allocateur &allocateur) :
+            TableHachage(100, allocateur) {}
 
     /**
      * @brief Ajoute une paire clef-valeur dans la table de dispersion
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
      * @param clef La clé de la paire clef-valeur
      * @param element La valeur de la paire clef-valeur
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    void
-    TableHachage<TypeClef, TypeElement, FoncteurHashage>::inserer(const TypeClef &clef, const TypeElement &element) {
-        PRECONDITION(!contient(clef));
-        size_t index = _trouverPositionLibre(clef);
-        m_tab.at(index) = TableHachage::EntreeHachage(clef, element, OCCUPE);
-        ++m_cardinalite;
-        if (_doitEtreRehachee()) rehacher();
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::inserer(
+            const TypeClef &clef, const TypeElement &element) {
+        ResultatSondage resultat = _sonder(clef);
+        PRECONDITION(!resultat.trouvee);
+        _placer(resultat, clef, element);
+    }
+
+    /**
+     * @brief Ajoute une paire clef-valeur dans la table de dispersion en y déplaçant la clef et la valeur, sans les
+     * copier
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur de la paire clef-valeur
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::inserer(
+            TypeClef &&clef, TypeElement &&element) {
+        ResultatSondage resultat = _sonder(clef);
+        PRECONDITION(!resultat.trouvee);
+        _placer(resultat, std::move(clef), std::move(element));
+    }
 
+    /**
+     * @brief Ajoute une plage de paires clef-valeur. La table est d'abord agrandie une seule fois pour le nombre total
+     * de paires, de sorte qu'aucune insertion de la plage ne rehache la table.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam IterateurPaires Un itérateur avant sur des paires dont first est la clef et second la valeur
+     * @param debut Le début de la plage
+     * @param fin La fin de la plage
+     * @except PreconditionException si une clef est déjà présente ou apparaît plus d'une fois dans la plage
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename IterateurPaires, typename>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::inserer(
+            IterateurPaires debut, IterateurPaires fin) {
+        reserver(m_cardinalite + std::distance(debut, fin));
+        for (; debut != fin; ++debut) inserer(debut->first, debut->second);
     }
 
     /**
@@ -45,14 +135,21 @@ namespace labTableHachage {
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
      * @param clef La clé de la paire clef-valeur à retirer
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    void TableHachage<TypeClef, TypeElement, FoncteurHashage>::enlever(const TypeClef &clef) {
-        PRECONDITION(contient(clef));
-        size_t index = _trouverPositionClef(clef);
-        m_tab.at(index).m_info = EFFACE;
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::enlever(
+            const ClefCompatible &clef) {
+        ResultatSondage resultat = _sonder(clef);
+        PRECONDITION(resultat.trouvee);
+        m_tab[resultat.index].m_info = EFFACE;
         --m_cardinalite;
+        ++m_nEffaces;
+        if (_doitEtreReduite()) _rehacher(_capaciteRequise(2 * m_cardinalite, m_tauxMax));
     }
 
     /**
@@ -60,82 +157,704 @@ namespace labTableHachage {
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
      * @return Le nombre d'éléments de la table de dispersion
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    int TableHachage<TypeClef, TypeElement, FoncteurHashage>::taille() const {
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    int TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::taille() const {
         return m_cardinalite;
     }
 
+    /**
+     * @brief Donne le nombre de positions de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return La capacité actuelle de la table de dispersion
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    size_t TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::capacite() const {
+        return m_tailleTable;
+    }
+
     /**
      * @brief Donne le taux moyen de collisions: le nombre total de collisions divisé par le nombre d'insertions
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
      * @return Le nombre de collisions divisé par le nombre d'insertions
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    double TableHachage<TypeClef, TypeElement, FoncteurHashage>::statistiques() const {
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    double TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::statistiques() const {
         PRECONDITION(taille() > 0);
         return static_cast<double>(m_nCollisions) / static_cast<double>(m_nInsertions);
     }
 
+    /**
+     * @brief Donne le nombre d'entrées effacées que contient la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return Le nombre d'entrées effacées depuis le dernier rehachage ou compactage
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    size_t TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::nombreEffaces() const {
+        return m_nEffaces;
+    }
+
+    /**
+     * @brief Donne le nombre de compactages des entrées effacées faits depuis la construction de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return Le nombre de compactages
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    unsigned long
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::nombreCompactages() const {
+        return m_nCompactages;
+    }
+
+    /**
+     * @brief Donne le nombre de fils qui se partagent chaque rehachage
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return Le nombre de fils, 1 si les rehachages sont séquentiels
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    size_t
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::reqFilsRehachage() const {
+        return m_nFilsRehachage;
+    }
+
+    /**
+     * @brief Active le rehachage parallèle: les rehachages suivants, qu'ils soient demandés par rehacher ou reserver
+     * ou déclenchés par une insertion, partagent le replacement des entrées entre nFils fils. Les tables de capacité
+     * inférieure à SEUIL_REHACHAGE_PARALLELE restent rehachées séquentiellement, car le démarrage des fils y coûterait
+     * plus que le replacement. Le foncteur de hachage est alors appelé par plusieurs fils à la fois.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param nFils Le nombre de fils, 1 pour revenir aux rehachages séquentiels
+     * @except PreconditionException si nFils est nul
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::asgFilsRehachage(
+            size_t nFils) {
+        PRECONDITION(nFils > 0);
+        m_nFilsRehachage = nFils;
+    }
+
+    /**
+     * @brief Donne le taux de remplissage maximum de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return Le pourcentage d'entrées occupées au-delà duquel une insertion agrandit la table, TAUX_MAX par défaut
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    int TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::reqTauxMax() const {
+        return m_tauxMax;
+    }
+
+    /**
+     * @brief Change le taux de remplissage maximum de la table. Un taux plus bas raccourcit les séquences de sondage
+     * au prix de plus de mémoire; la table est agrandie immédiatement si elle dépasse le nouveau taux. Les entrées
+     * effacées sont compactées lorsque les entrées occupées et effacées dépassent la moitié du chemin entre ce taux
+     * et COUVERTURE, le taux des positions que le sondage visite.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param taux Le nouveau taux maximum, en pourcentage
+     * @except PreconditionException si taux dépasse TAUX_MAX, le taux que le sondage supporte, ou n'est pas
+     * supérieur au double du taux minimum
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::asgTauxMax(int taux) {
+        PRECONDITION(taux <= TAUX_MAX);
+        PRECONDITION(taux > 2 * m_tauxMin && taux > 0);
+        m_tauxMax = taux;
+        reserver(m_cardinalite);
+    }
+
+    /**
+     * @brief Donne le taux de remplissage minimum de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return Le pourcentage d'entrées occupées sous lequel un retrait réduit la table, 0 par défaut
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    int TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::reqTauxMin() const {
+        return m_tauxMin;
+    }
+
+    /**
+     * @brief Active la réduction automatique: un retrait qui fait passer le taux de remplissage sous taux rehache la
+     * table à la capacité où elle serait remplie à la moitié du taux maximum. Comme une insertion, un tel retrait
+     * invalide les références, les pointeurs et les itérateurs sur la table.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param taux Le nouveau taux minimum, en pourcentage, 0 pour ne jamais réduire la table
+     * @except PreconditionException si taux est négatif ou si son double atteint le taux maximum, ce qui ferait
+     * alterner agrandissements et réductions
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::asgTauxMin(int taux) {
+        PRECONDITION(taux >= 0 && 2 * taux < m_tauxMax);
+        m_tauxMin = taux;
+    }
+
+    /**
+     * @brief Donne le facteur d'agrandissement de la capacité
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return Le facteur par lequel un rehachage multiplie la capacité, avant de l'arrondir à une capacité valide
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    double
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::reqFacteurCroissance() const {
+        return m_facteurCroissance;
+    }
+
+    /**
+     * @brief Change le facteur d'agrandissement de la capacité. Un petit facteur gaspille moins de mémoire après un
+     * agrandissement, mais rehache la table plus souvent. Avec CapacitePuissanceDeux, la capacité est arrondie à la
+     * puissance de deux suivante: tout facteur jusqu'à 2 double donc la capacité.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param facteur Le nouveau facteur
+     * @except PreconditionException si facteur n'est pas supérieur à 1
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::asgFacteurCroissance(
+            double facteur) {
+        PRECONDITION(facteur > 1);
+        m_facteurCroissance = facteur;
+    }
+
+    /**
+     * @brief Réduit la table, en un seul rehachage, à la plus petite capacité qui contient ses éléments sans dépasser
+     * le taux maximum. Ne fait rien si la capacité actuelle est déjà celle-là.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::ajusterCapacite() {
+        size_t capacite = _capaciteRequise(m_cardinalite, m_tauxMax);
+        if (capacite < m_tailleTable) _rehacher(capacite);
+    }
+
+    /**
+     * @brief Donne l'allocateur de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return Une copie de l'allocateur donné à la construction
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    Allocateur
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::reqAllocateur() const {
+        return Allocateur(m_tab.get_allocator());
+    }
+
     /**
      * @brief Vérifie la présence d'une paire clef-valeur dans la table, à partir de la clef
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
      * @param clef la clef de la paire clef-valeur cherchée
      * @return true si la clef est présente dans la table
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    bool TableHachage<TypeClef, TypeElement, FoncteurHashage>::contient(const TypeClef &clef) const {
-        size_t index = _trouverPositionClef(clef);
-        return m_tab.at(index).m_info == OCCUPE;
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    bool TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::contient(
+            const ClefCompatible &clef) const {
+        return _sonder(clef).trouvee;
+    }
+
+    /**
+     * @brief Retourne la valeur correspondant à une clef donnée, sans la copier
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Une référence sur la valeur correspondant à la clef, invalidée par la prochaine insertion ou le prochain
+     * rehachage
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    const TypeElement &TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::element(
+            const ClefCompatible &clef) const {
+        ResultatSondage resultat = _sonder(clef);
+        PRECONDITION(resultat.trouvee);
+        return m_tab[resultat.index].m_el;
+    }
+
+    /**
+     * @brief Version modifiable de element
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Une référence modifiable sur la valeur correspondant à la clef
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    TypeElement &TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::element(
+            const ClefCompatible &clef) {
+        ResultatSondage resultat = _sonder(clef);
+        PRECONDITION(resultat.trouvee);
+        return m_tab[resultat.index].m_el;
+    }
+
+    /**
+     * @brief Cherche la valeur correspondant à une clef en une seule séquence de sondage
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente. Le pointeur est invalidé par
+     * la prochaine insertion ou le prochain rehachage.
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    TypeElement *TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::trouver(
+            const ClefCompatible &clef) {
+        ResultatSondage resultat = _sonder(clef);
+        return resultat.trouvee ? &m_tab[resultat.index].m_el : nullptr;
     }
 
     /**
-     * @brief Retourne la valeur correspondant à une clef donnée
+     * @brief Version constante de trouver
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
      * @param clef La clef de la paire clef-valeur cherchée
-     * @return La valeur correspondant à la clef
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    const TypeElement *TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::trouver(
+            const ClefCompatible &clef) const {
+        ResultatSondage resultat = _sonder(clef);
+        return resultat.trouvee ? &m_tab[resultat.index].m_el : nullptr;
+    }
+
+    /**
+     * @brief Vérifie la présence de plusieurs clefs. Équivalent à appeler contient pour chaque clef, mais les positions
+     * initiales de TAILLE_GROUPE_LOT clefs sont calculées et préchargées avant que la première ne soit lue: les accès
+     * à la mémoire de ces clefs se chevauchent au lieu de s'attendre l'un l'autre.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clefs Les n clefs cherchées
+     * @param n Le nombre de clefs
+     * @param resultats Reçoit n booléens, true si la clef de même position est présente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::contientLot(
+            const ClefCompatible *clefs, size_t n, bool *resultats) const {
+        _sonderLot(clefs, n, [resultats](size_t i, const ResultatSondage &resultat) {
+            resultats[i] = resultat.trouvee;
+        });
+    }
+
+    /**
+     * @brief Cherche les valeurs de plusieurs clefs, avec le même préchargement que contientLot
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clefs Les n clefs cherchées
+     * @param n Le nombre de clefs
+     * @param resultats Reçoit n pointeurs, comme ceux que retournerait trouver pour la clef de même position
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::trouverLot(
+            const ClefCompatible *clefs, size_t n, const TypeElement **resultats) const {
+        _sonderLot(clefs, n, [this, resultats](size_t i, const ResultatSondage &resultat) {
+            resultats[i] = resultat.trouvee ? &m_tab[resultat.index].m_el : nullptr;
+        });
+    }
+
+    /**
+     * @brief Insère la paire clef-valeur si la clef est absente, sinon remplace la valeur associée à la clef
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur à associer à la clef
+     * @return true si la paire a été insérée, false si une valeur existante a été remplacée
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    bool TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::insererOuAssigner(
+            const TypeClef &clef, const TypeElement &element) {
+        ResultatSondage resultat = _sonder(clef);
+        if (resultat.trouvee) {
+            m_tab[resultat.index].m_el = element;
+            return false;
+        }
+        _placer(resultat, clef, element);
+        return true;
+    }
+
+    /**
+     * @brief Insère la paire clef-valeur seulement si la clef est absente
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur à insérer si la clef est absente
+     * @return Un pointeur sur la valeur associée à la clef dans la table (existante ou nouvellement insérée) et true
+     * si l'insertion a eu lieu
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    std::pair<TypeElement *, bool>
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::insererSiAbsent(
+            const TypeClef &clef, const TypeElement &element) {
+        return emplacer(clef, element);
+    }
+
+    /**
+     * @brief Construit la valeur associée à la clef à partir des arguments donnés, seulement si la clef est absente.
+     * Les arguments ne sont pas utilisés si la clef est présente.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam Args Les types des arguments du constructeur de TypeElement
+     * @param clef La clé de la paire clef-valeur
+     * @param args Les arguments transmis au constructeur de la valeur
+     * @return Un pointeur sur la valeur associée à la clef dans la table (existante ou nouvellement construite) et
+     * true si l'insertion a eu lieu
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename... Args>
+    std::pair<TypeElement *, bool>
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::emplacer(
+            const TypeClef &clef, Args &&... args) {
+        ResultatSondage resultat = _sonder(clef);
+        if (resultat.trouvee) return std::make_pair(&m_tab[resultat.index].m_el, false);
+        size_t index = _placer(resultat, clef, std::forward<Args>(args)...);
+        return std::make_pair(&m_tab[index].m_el, true);
+    }
+
+    /**
+     * @brief Comme emplacer(const TypeClef &, Args &&...), mais la clef est déplacée dans la table si elle est absente
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam Args Les types des arguments du constructeur de TypeElement
+     * @param clef La clé de la paire clef-valeur
+     * @param args Les arguments transmis au constructeur de la valeur
+     * @return Un pointeur sur la valeur associée à la clef dans la table (existante ou nouvellement construite) et
+     * true si l'insertion a eu lieu
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename... Args>
+    std::pair<TypeElement *, bool>
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::emplacer(
+            TypeClef &&clef, Args &&... args) {
+        ResultatSondage resultat = _sonder(clef);
+        if (resultat.trouvee) return std::make_pair(&m_tab[resultat.index].m_el, false);
+        size_t index = _placer(resultat, std::move(clef), std::forward<Args>(args)...);
+        return std::make_pair(&m_tab[index].m_el, true);
+    }
+
+    /**
+     * @brief Donne accès à la valeur associée à une clef, en insérant d'abord une valeur construite par défaut si la
+     * clef est absente
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param clef La clé de la paire clef-valeur
+     * @return Une référence sur la valeur associée à la clef
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    TypeElement &TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::operator[](
+            const TypeClef &clef) {
+        return *emplacer(clef).first;
+    }
+
+    /**
+     * @brief Comme operator[](const TypeClef &), mais la clef est déplacée dans la table si elle est absente
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param clef La clé de la paire clef-valeur
+     * @return Une référence sur la valeur associée à la clef
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    TypeElement &
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::operator[](TypeClef &&clef) {
+        return *emplacer(std::move(clef)).first;
+    }
+
+    /**
+     * @brief Donne un itérateur sur la première paire clef-valeur de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return Un itérateur sur la première entrée occupée, ou end() si la table est vide
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    typename TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::Iterateur
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::begin() {
+        return Iterateur(m_tab.data(), m_tab.data() + m_tab.size(), m_generation);
+    }
+
+    /**
+     * @brief Donne l'itérateur qui suit la dernière paire clef-valeur de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return L'itérateur de fin
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    typename TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::Iterateur
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::end() {
+        return Iterateur(m_tab.data() + m_tab.size(), m_tab.data() + m_tab.size(), m_generation);
+    }
+
+    /**
+     * @brief Version constante de begin
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return Un itérateur constant sur la première entrée occupée, ou end() si la table est vide
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    TypeElement TableHachage<TypeClef, TypeElement, FoncteurHashage>::element(const TypeClef &clef) const {
-        PRECONDITION(contient(clef));
-        size_t index = _trouverPositionClef(clef);
-        return m_tab.at(index).m_el;
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    typename TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::IterateurConstant
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::begin() const {
+        return IterateurConstant(m_tab.data(), m_tab.data() + m_tab.size(), m_generation);
     }
 
     /**
-     * @brief Enlève tous les éléments de la table
+     * @brief Version constante de end
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return L'itérateur constant de fin
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    void TableHachage<TypeClef, TypeElement, FoncteurHashage>::vider() {
-        for (auto &entree: m_tab) entree.m_info = VACANT;
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    typename TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::IterateurConstant
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::end() const {
+        return IterateurConstant(m_tab.data() + m_tab.size(), m_tab.data() + m_tab.size(), m_generation);
+    }
+
+    /**
+     * @brief Enlève tous les éléments de la table. Si VIDER_PAR_GENERATION, incrémente seulement la génération de la
+     * table, en temps constant; les entrées ne sont parcourues que lorsque le compteur revient à zéro.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::vider() {
         m_cardinalite = 0;
+        m_nEffaces = 0;
+        if constexpr (VIDER_PAR_GENERATION) {
+            if (++m_generation != 0) return;
+        }
+        for (auto &entree: m_tab) {
+            entree.m_info = VACANT;
+            entree.asgGeneration(m_generation);
+        }
+    }
+
+    /**
+     * @brief Agrandit la table à la capacité valide selon PolitiqueCapacite qui suit la capacité actuelle multipliée
+     * par le facteur d'agrandissement: par défaut, le nombre premier suivant immédiatement le double de la taille
+     * actuelle. La nouvelle capacité peut toujours recevoir un élément de plus sans dépasser le taux maximum.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::rehacher() {
+        size_t agrandie = static_cast<size_t>(std::ceil(m_tailleTable * m_facteurCroissance));
+        _rehacher(std::max(PolitiqueCapacite::capacite(agrandie), _capaciteRequise(m_cardinalite + 1, m_tauxMax)));
+    }
+
+    /**
+     * @brief Agrandit la table, en un seul rehachage, pour que n éléments puissent y être insérés sans dépasser
+     * le taux maximum. Ne fait rien si la capacité actuelle suffit déjà.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param n Le nombre total d'éléments prévu
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::reserver(size_t n) {
+        size_t capacite = _capaciteRequise(n, m_tauxMax);
+        if (capacite > m_tailleTable) _rehacher(capacite);
     }
 
     /**
-     * @brief Agrandit la table lorsque qu'un certain taux d'occupation est atteint
+     * @brief Rehache la table dans un tableau de la capacité donnée. Les entrées occupées sont déplacées directement
+     * de l'ancien tableau vers le nouveau, sans copie.
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param nouvelleTaille La nouvelle capacité, valide selon PolitiqueCapacite
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    void TableHachage<TypeClef, TypeElement, FoncteurHashage>::rehacher() {
-        std::vector<EntreeHachage> sauvegarde;
-        _reqEntreesActives(sauvegarde);
-        vider();
-        _redimensionner();
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_rehacher(
+            size_t nouvelleTaille) {
+        Tableau ancienne(m_tab.get_allocator());
+        ancienne.swap(m_tab);
+        _redimensionner(nouvelleTaille);
         m_hachage = FoncteurHashage(m_tailleTable);
-        for (auto entree: sauvegarde) inserer(entree.m_clef, entree.m_el);
+        m_cardinalite = 0;
+        m_nEffaces = 0;
+        if (m_nFilsRehachage > 1 && ancienne.size() >= SEUIL_REHACHAGE_PARALLELE) {
+            _replacerParallele(ancienne);
+            return;
+        }
+        for (auto &entree: ancienne) {
+            if (_etat(entree) != OCCUPE) continue;
+            ResultatSondage resultat = _sonderPositionLibre(entree.m_clef, _hashEntree(entree));
+            m_tab[resultat.index] = std::move(entree);
+            ++m_cardinalite;
+            _statistiques(resultat.collisions);
+        }
+    }
 
+    /**
+     * @brief Replace les entrées occupées de l'ancien tableau dans le nouveau, vide, en partageant l'ancien tableau en
+     * m_nFilsRehachage tranches contiguës, une par fil. Deux fils peuvent sonder la même position: chaque position du
+     * nouveau tableau est donc réservée par un compare_exchange sur son propre drapeau avant d'être écrite, et un fil
+     * qui perd la réservation continue sa séquence de sondage comme après une collision. Chaque entrée du nouveau
+     * tableau n'est écrite que par le fil qui l'a réservée.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param ancienne L'ancien tableau, dont les entrées occupées sont déplacées
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_replacerParallele(
+            Tableau &ancienne) {
+        std::unique_ptr<std::atomic<bool>[]> reservees(new std::atomic<bool>[m_tailleTable]());
+        std::vector<size_t> cardinalites(m_nFilsRehachage), collisions(m_nFilsRehachage);
+        size_t tranche = (ancienne.size() + m_nFilsRehachage - 1) / m_nFilsRehachage;
+        std::vector<std::thread> fils;
+        for (size_t f = 0; f < m_nFilsRehachage; ++f) {
+            fils.push_back(std::thread([this, &ancienne, &reservees, &cardinalites, &collisions, tranche, f]() {
+                size_t cardinalite = 0, nCollisions = 0;
+                size_t fin = std::min(ancienne.size(), (f + 1) * tranche);
+                for (size_t i = f * tranche; i < fin; ++i) {
+                    if (_etat(ancienne[i]) != OCCUPE) continue;
+                    size_t hash = _hashEntree(ancienne[i]);
+                    size_t index = _indice(ancienne[i].m_clef, hash, 0);
+                    size_t tentative = 1;
+                    bool reservee = false;
+                    while (reservees[index].load(std::memory_order_relaxed) ||
+                           !reservees[index].compare_exchange_strong(reservee, true, std::memory_order_relaxed)) {
+                        reservee = false;
+                        index = _suivant(ancienne[i].m_clef, hash, index, tentative);
+                        ++tentative;
+                    }
+                    m_tab[index] = std::move(ancienne[i]);
+                    ++cardinalite;
+                    nCollisions += tentative - 1;
+                }
+                cardinalites[f] = cardinalite;
+                collisions[f] = nCollisions;
+            }));
+        }
+        for (std::thread &t: fils) t.join();
+        for (size_t f = 0; f < m_nFilsRehachage; ++f) {
+            m_cardinalite += cardinalites[f];
+            m_nInsertions += cardinalites[f];
+            m_nCollisions += collisions[f];
+        }
     }
 
     /**
@@ -143,10 +862,12 @@ namespace labTableHachage {
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
      * @param p_out Le flux de sortie
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
-    void TableHachage<TypeClef, TypeElement, FoncteurHachage>::afficher(
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite, Allocateur>::afficher(
             std::ostream &p_out) const {
         p_out << "{";
         for (size_t i = 0; i < m_tab.size(); ++i) {
@@ -162,60 +883,285 @@ namespace labTableHachage {
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
      * @param p_out
      * @param p_source
      * @return
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
-    std::ostream &operator<<(std::ostream &p_out,
-                             const TableHachage <TypeClef, TypeElement, FoncteurHachage> &p_source) {
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite, class Allocateur>
+    std::ostream &
+    operator<<(std::ostream &p_out,
+               const TableHachage<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite, Allocateur> &p_source) {
         p_source.afficher(p_out);
         return p_out;
     }
 
     /**
-     * @brief Tente de trouver un hash vacant correspondant à la clef.  Recommence tant qu'une place libre n'est pas
-     * trouvée.
+     * @brief Parcourt une seule fois la séquence de sondage d'une clef. Recommence jusqu'à ce que la clef soit
+     * localisée ou qu'une place vacante soit atteinte, en retenant au passage la première place effacée.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clef La clef souhaitée
+     * @return La position de la clef si elle est présente, sinon la première position libre de sa séquence
+     * @except AssertionError si un nombre excessif de collisions est rencontré
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    typename TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::ResultatSondage
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_sonder(
+            const ClefCompatible &clef) const {
+        size_t hash = _hashPrimaire(clef);
+        return _sonder(clef, hash, _indice(clef, hash, 0));
+    }
+
+    /**
+     * @brief Sonde un lot de clefs par groupes de TAILLE_GROUPE_LOT: calcule et précharge la position initiale de
+     * chaque clef du groupe, puis sonde les clefs du groupe dans l'ordre
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @tparam Traitement Appelable avec la position de la clef dans le lot et son ResultatSondage
+     * @param clefs Les n clefs à sonder
+     * @param n Le nombre de clefs
+     * @param traiter Appelé une fois par clef, dans l'ordre du lot
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible, typename Traitement>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_sonderLot(
+            const ClefCompatible *clefs, size_t n, Traitement traiter) const {
+        size_t hash[TAILLE_GROUPE_LOT], index[TAILLE_GROUPE_LOT];
+        for (size_t debut = 0; debut < n; debut += TAILLE_GROUPE_LOT) {
+            size_t taille = n - debut < TAILLE_GROUPE_LOT ? n - debut : TAILLE_GROUPE_LOT;
+            for (size_t i = 0; i < taille; ++i) {
+                hash[i] = _hashPrimaire(clefs[debut + i]);
+                index[i] = _indice(clefs[debut + i], hash[i], 0);
+                precharger(&m_tab[index[i]]);
+            }
+            for (size_t i = 0; i < taille; ++i) traiter(debut + i, _sonder(clefs[debut + i], hash[i], index[i]));
+        }
+    }
+
+    /**
+     * @brief Parcourt la séquence de sondage d'une clef dont le hash et la position initiale sont déjà calculés, comme
+     * _sonder. Si CONSERVER_HASH, seules les entrées dont le hash conservé est égal sont comparées à la clef.
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
      * @param clef La clef souhaitée
-     * @return Un indice pointant à un endroit vacant dans la table
+     * @param hash Le hash primaire de la clef, donné par _hashPrimaire
+     * @param index La première position de la séquence de sondage de la clef
+     * @return La position de la clef si elle est présente, sinon la première position libre de sa séquence
      * @except AssertionError si un nombre excessif de collisions est rencontré
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    size_t TableHachage<TypeClef, TypeElement, FoncteurHashage>::_trouverPositionLibre(const TypeClef &clef) {
-        size_t index = m_hachage(clef, 0);
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    typename TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::ResultatSondage
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_sonder(
+            const ClefCompatible &clef, size_t hash, size_t index) const {
         size_t tentative = 1;
-        while (_estOccupee(index)) {
-            index = m_hachage(clef, tentative);
+        bool libreTrouvee = false;
+        ResultatSondage resultat = {0, false, 0, hash};
+        while (!_estVacante(index)) {
+            if (_estOccupee(index)) {
+                if (m_tab[index].memeHash(hash) && m_tab[index].m_clef == clef) {
+                    resultat.index = index;
+                    resultat.trouvee = true;
+                    return resultat;
+                }
+            } else if (!libreTrouvee) {
+                libreTrouvee = true;
+                resultat.index = index;
+                resultat.collisions = tentative - 1;
+            }
+            index = _suivant(clef, hash, index, tentative);
             ++tentative;
             ASSERTION(tentative < MAX_TENTATIVES);
         }
-        _statistiques(tentative - 1);
-        return index;
-
+        if (!libreTrouvee) {
+            resultat.index = index;
+            resultat.collisions = tentative - 1;
+        }
+        return resultat;
     }
 
     /**
-     * @brief Trouve un index correspondant à une clef donnée. Recommence jusqu'à ce que la clef soit localisée ou la
-     * place soit vacante.
+     * @brief Parcourt la séquence de sondage d'une clef absente jusqu'à la première position libre, sans comparer les
+     * clefs rencontrées
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
-     * @param clef La clef souhaitée
-     * @return Un index qui: contient la clef, ou est libre.
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param clef Une clef qui n'est pas dans la table
+     * @param hash Le hash primaire de la clef, donné par _hashPrimaire ou conservé dans son entrée
+     * @return La première position libre de la séquence de sondage de la clef
+     * @except AssertionError si un nombre excessif de collisions est rencontré
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    size_t TableHachage<TypeClef, TypeElement, FoncteurHashage>::_trouverPositionClef(const TypeClef &clef) const {
-        size_t index = m_hachage(clef, 0);
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    typename TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::ResultatSondage
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_sonderPositionLibre(
+            const TypeClef &clef, size_t hash) const {
+        size_t index = _indice(clef, hash, 0);
         size_t tentative = 1;
-        while ((m_tab.at(index).m_clef != clef) and (!_estVacante(index))) {
-            index = m_hachage(clef, tentative);
+        while (_estOccupee(index)) {
+            index = _suivant(clef, hash, index, tentative);
             ++tentative;
             ASSERTION(tentative < MAX_TENTATIVES);
         }
-        return index;
+        ResultatSondage resultat = {index, false, tentative - 1, hash};
+        return resultat;
+    }
+
+    /**
+     * @brief Donne le hash primaire d'une clef si CONSERVER_HASH ou SONDAGE_INCREMENTAL, sans hacher la clef sinon
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clef La clef
+     * @return Le hash primaire de la clef si CONSERVER_HASH ou SONDAGE_INCREMENTAL, sinon 0
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    size_t TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_hashPrimaire(
+            const ClefCompatible &clef) const {
+        if constexpr (CONSERVER_HASH || SONDAGE_INCREMENTAL) return m_hachage.primaire(clef);
+        else return 0;
+    }
+
+    /**
+     * @brief Donne le hash primaire de la clef d'une entrée, pour la replacer: le hash conservé si CONSERVER_HASH,
+     * sans rehacher la clef
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param entree Une entrée occupée
+     * @return Le hash primaire de la clef de l'entrée, comme le donnerait _hashPrimaire
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    size_t TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_hashEntree(
+            const EntreeHachage &entree) const {
+        if constexpr (CONSERVER_HASH) return entree.reqHash();
+        else return _hashPrimaire(entree.m_clef);
+    }
+
+    /**
+     * @brief Donne une position de la séquence de sondage d'une clef: à partir du hash primaire si CONSERVER_HASH ou
+     * SONDAGE_INCREMENTAL, sans rehacher la clef, sinon en hachant la clef
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clef La clef
+     * @param hash Le hash primaire de la clef, donné par _hashPrimaire
+     * @param tentative Le nombre de tentatives déjà faites
+     * @return La position de la séquence de sondage de la clef après tentative collisions
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    size_t TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_indice(
+            const ClefCompatible &clef, size_t hash, size_t tentative) const {
+        if constexpr (CONSERVER_HASH || SONDAGE_INCREMENTAL) return m_hachage.indice(hash, tentative);
+        else return m_hachage(clef, tentative);
+    }
+
+    /**
+     * @brief Donne la position suivante de la séquence de sondage d'une clef: à partir de la position précédente si
+     * SONDAGE_INCREMENTAL, par une addition, sinon comme _indice
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clef La clef
+     * @param hash Le hash primaire de la clef, donné par _hashPrimaire
+     * @param index La position de la séquence après tentative - 1 collisions
+     * @param tentative Le nombre de tentatives déjà faites, au moins 1
+     * @return La position de la séquence de sondage de la clef après tentative collisions
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename ClefCompatible>
+    size_t TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_suivant(
+            const ClefCompatible &clef, size_t hash, size_t index, size_t tentative) const {
+        if constexpr (SONDAGE_INCREMENTAL) return m_hachage.suivant(index, hash, tentative);
+        else return _indice(clef, hash, tentative);
+    }
+
+    /**
+     * @brief Place une nouvelle paire clef-valeur à la position libre trouvée par _sonder. La table est d'abord
+     * rehachée ou compactée si l'ajout dépasserait un des taux maximums, puis la clef et la valeur sont transmises
+     * directement à l'entrée, sans passer par une entrée temporaire. Un compactage qui libérerait moins d'un seizième
+     * de la table est remplacé par un agrandissement: près du taux maximum, il devrait sinon être refait après presque
+     * chaque retrait.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @tparam C Le type de la référence à la clef, déplacée si c'est une rvalue
+     * @tparam Args Les types des arguments du constructeur de TypeElement
+     * @param resultat Le résultat du sondage de la clef, qui ne doit pas avoir été trouvée, avec son hash
+     * @param clef La clé de la paire clef-valeur
+     * @param args Les arguments transmis au constructeur de la valeur
+     * @return L'index de la nouvelle entrée, qui tient compte d'un éventuel rehachage ou compactage
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    template<typename C, typename... Args>
+    size_t TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_placer(
+            ResultatSondage resultat, C &&clef, Args &&... args) {
+        if (_doitEtreRehachee()) {
+            rehacher();
+            resultat = _sonderPositionLibre(clef, resultat.hash);
+        } else if (_doitEtreCompactee(resultat.index)) {
+            if (16 * m_nEffaces < m_tailleTable) rehacher();
+            else _compacter();
+            resultat = _sonderPositionLibre(clef, resultat.hash);
+        }
+        if (_estEffacee(resultat.index)) --m_nEffaces;
+        EntreeHachage &entree = m_tab[resultat.index];
+        entree.asgHash(resultat.hash);
+        entree.m_clef = std::forward<C>(clef);
+        entree.m_el = construireAvecAllocateur<TypeElement>(m_tab.get_allocator(), std::forward<Args>(args)...);
+        entree.m_info = OCCUPE;
+        entree.asgGeneration(m_generation);
+        ++m_cardinalite;
+        _statistiques(resultat.collisions);
+        return resultat.index;
+    }
+
+    /**
+     * @brief Donne l'état d'une entrée: vacante si elle date d'une génération antérieure à la dernière vidange
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param entree Une entrée de la table
+     * @return L'état de l'entrée dans la génération courante de la table
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    typename TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::EtatEntree
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_etat(
+            const EntreeHachage &entree) const {
+        return entree.estCourante(m_generation) ? entree.m_info : VACANT;
     }
 
     /**
@@ -223,12 +1169,15 @@ namespace labTableHachage {
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
      * @param i
      * @return true si la table est vacante en position i
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    bool TableHachage<TypeClef, TypeElement, FoncteurHashage>::_estVacante(size_t i) const {
-        return m_tab.at(i).m_info == VACANT;
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    bool
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_estVacante(size_t i) const {
+        return _etat(m_tab.at(i)) == VACANT;
     }
 
     /**
@@ -236,12 +1185,15 @@ namespace labTableHachage {
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
      * @param i Un index dans la table
      * @return true si la table est effacée en position i
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    bool TableHachage<TypeClef, TypeElement, FoncteurHashage>::_estEffacee(size_t i) const {
-        return m_tab.at(i).m_info == EFFACE;
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    bool
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_estEffacee(size_t i) const {
+        return _etat(m_tab.at(i)) == EFFACE;
     }
 
     /**
@@ -249,125 +1201,163 @@ namespace labTableHachage {
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
      * @param i un index dans la table
      * @return true si la table est occupée à la position i
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    bool TableHachage<TypeClef, TypeElement, FoncteurHashage>::_estOccupee(size_t i) const {
-        return m_tab.at(i).m_info == OCCUPE;
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    bool
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_estOccupee(size_t i) const {
+        return _etat(m_tab.at(i)) == OCCUPE;
     }
 
     /**
-     * @brief Indique si le taux d'occupation de la table est supérieur à TAUX_MAX qui est un attribut statique défini
-     * dans TableHachage.h
+     * @brief Indique si l'ajout d'une entrée porterait le taux d'occupation de la table au-delà du taux maximum
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
-     * @return true si le taux d'occupation de la table est supérieur à TAUX_MAX
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return true si la table doit être rehachée avant l'ajout
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    bool TableHachage<TypeClef, TypeElement, FoncteurHashage>::_doitEtreRehachee() const {
-        return 100 * m_cardinalite > TAUX_MAX * m_tailleTable;
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    bool
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_doitEtreRehachee() const {
+        return 100 * (m_cardinalite + 1) > m_tauxMax * m_tailleTable;
     }
 
     /**
-     * @brief Retourne un vecteur contenant toutes les paires clef-valeur de la table
+     * @brief Indique si l'ajout d'une entrée à la position donnée porterait les entrées occupées et effacées au-delà
+     * de la moitié du chemin entre le taux maximum et COUVERTURE: au-delà de COUVERTURE, un sondage pourrait ne plus
+     * rencontrer de position vacante
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
-     * @param sauvegarde Vecteur contenant les entrées de la table
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param i La position libre où l'entrée serait ajoutée
+     * @return true si les entrées effacées doivent être compactées avant l'ajout
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    void TableHachage<TypeClef, TypeElement, FoncteurHashage>::_reqEntreesActives(
-            std::vector<EntreeHachage> &sauvegarde) const {
-        sauvegarde.clear();
-        for (auto entree: m_tab) {
-            if (entree.m_info == OCCUPE) sauvegarde.push_back(entree);
-        }
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    bool
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_doitEtreCompactee(
+            size_t i) const {
+        size_t utilisees = m_cardinalite + m_nEffaces + (_estEffacee(i) ? 0 : 1);
+        return 200 * utilisees > static_cast<size_t>(m_tauxMax + COUVERTURE) * m_tailleTable;
     }
 
     /**
-     * @brief Agrandit la table au nombre suivant: le nombre premier suivant immédiatement le double de la taille
-     * actuelle.
+     * @brief Indique si un retrait a fait passer le taux d'occupation de la table sous le taux minimum, et si la
+     * capacité qui la remplirait à la moitié du taux maximum est plus petite que la capacité actuelle
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @return true si la table doit être réduite
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    void TableHachage<TypeClef, TypeElement, FoncteurHashage>::_redimensionner() {
-        size_t nouvelleTaille = _prochainPremier(2 * m_tailleTable);
-        m_tab.resize(nouvelleTaille);
-        m_tailleTable = nouvelleTaille;
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    bool TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_doitEtreReduite() const {
+        if (100 * m_cardinalite >= static_cast<size_t>(m_tauxMin) * m_tailleTable) return false;
+        return _capaciteRequise(2 * m_cardinalite, m_tauxMax) < m_tailleTable;
     }
 
     /**
-     * @brief À chaque appel de _trouverPositionLibre, incrément le nombre d'insertions de 1 et le nombre de collisions
-     * du nombre spécifié.
+     * @brief Élimine les entrées effacées sans changer la capacité ni allouer de mémoire. Les entrées effacées, et
+     * celles d'une génération antérieure, deviennent vacantes et les entrées occupées sont marquées A_REPLACER;
+     * chacune est ensuite replacée à la première position non occupée de sa séquence de sondage, en échangeant sa
+     * place avec une autre entrée à replacer au besoin.
      * @tparam TypeClef
      * @tparam TypeElement
      * @tparam FoncteurHashage
-     * @param collisions Le nombre de collisions rencontré lors de la tentative de trouver un index libre
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @except AssertionError si un nombre excessif de collisions est rencontré
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHashage>
-    void TableHachage<TypeClef, TypeElement, FoncteurHashage>::_statistiques(const size_t &collisions) {
-        m_nCollisions += collisions;
-        ++m_nInsertions;
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_compacter() {
+        for (auto &entree: m_tab) {
+            entree.m_info = _etat(entree) == OCCUPE ? A_REPLACER : VACANT;
+            entree.asgGeneration(m_generation);
+        }
+        for (size_t i = 0; i < m_tailleTable; ++i) {
+            while (m_tab[i].m_info == A_REPLACER) {
+                size_t hash = _hashEntree(m_tab[i]);
+                size_t index = _indice(m_tab[i].m_clef, hash, 0);
+                size_t tentative = 1;
+                while (index != i && _estOccupee(index)) {
+                    index = _suivant(m_tab[i].m_clef, hash, index, tentative);
+                    ++tentative;
+                    ASSERTION(tentative < MAX_TENTATIVES);
+                }
+                if (index == i) {
+                    m_tab[i].m_info = OCCUPE;
+                } else if (_estVacante(index)) {
+                    m_tab[index] = std::move(m_tab[i]);
+                    m_tab[index].m_info = OCCUPE;
+                    m_tab[i].m_info = VACANT;
+                } else {
+                    std::swap(m_tab[i], m_tab[index]);
+                    m_tab[index].m_info = OCCUPE;
+                }
+            }
+        }
+        m_nEffaces = 0;
+        ++m_nCompactages;
     }
 
-
     /**
-     * @brief Trouve le nombre premier suivant un nombre donné
+     * @brief Redimensionne le tableau des entrées à la capacité donnée
      * @tparam TypeClef
      * @tparam TypeElement
-     * @tparam FoncteurHachage
-     * @param p_entier Le nombre après lequel on veut trouver un nombre premier
-     * @return Le nombre premier suivant p_entier
-     */
-    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
-    int TableHachage<TypeClef, TypeElement, FoncteurHachage>::_prochainPremier(
-            int p_entier) {
-        if (p_entier % 2 == 0) {
-            p_entier++;
-        }
-        while (!_estPremier(p_entier)) {
-            p_entier += 2;
-        }
-        return p_entier;
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param nouvelleTaille La nouvelle capacité
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_redimensionner(
+            size_t nouvelleTaille) {
+        m_tab.resize(nouvelleTaille);
+        m_tailleTable = nouvelleTaille;
     }
 
     /**
-     * @brief Vérifie si un nombre est premier
+     * @brief Donne la plus petite capacité valide selon PolitiqueCapacite qui peut contenir n éléments sans dépasser
+     * un taux de remplissage
      * @tparam TypeClef
      * @tparam TypeElement
-     * @tparam FoncteurHachage
-     * @param p_entier Le nombre à vérifier
-     * @return true si p_entier est premier
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param n Un nombre d'éléments
+     * @param taux Le taux de remplissage maximum, en pourcentage
+     * @return La capacité requise pour n éléments
      */
-    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
-    bool TableHachage<TypeClef, TypeElement, FoncteurHachage>::_estPremier(
-            int p_entier) {
-        if (p_entier <= 1) {
-            return false;
-        }
-        if (p_entier == 2) {             // le seul nombre premier pair
-            return true;
-        }
-        if (p_entier % 2 == 0) {   // sinon, ce n'est pas un nombre premier
-            return false;
-        }
-
-        int divisor = 3;
-        int upperLimit = static_cast<int>(sqrt((float) p_entier) + 1);
-
-        while (divisor <= upperLimit) {
-            if (p_entier % divisor == 0) {
-                return false;
-            }
-            divisor += 2;
-        }
-        return true;
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    size_t TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_capaciteRequise(
+            size_t n, int taux) {
+        return PolitiqueCapacite::capacite((100 * n + taux - 1) / taux);
     }
 
+    /**
+     * @brief À chaque appel de _placer, incrément le nombre d'insertions de 1 et le nombre de collisions
+     * du nombre spécifié.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHashage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param collisions Le nombre de collisions rencontré lors de la tentative de trouver un index libre
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHashage, class PolitiqueCapacite, class Allocateur>
+    void
+    TableHachage<TypeClef, TypeElement, FoncteurHashage, PolitiqueCapacite, Allocateur>::_statistiques(
+            const size_t &collisions) {
+        m_nCollisions += collisions;
+        ++m_nInsertions;
+    }
 
 } //Fin du namespace
 
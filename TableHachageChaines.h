@@ -0,0 +1,163 @@
+/**
+ * \file TableHachageChaines.h
+ * \brief Classe définissant une table de hachage à clefs chaînes internées dans une arène contiguë.
+ * \version 0.4
+ * \date octobre 2026
+ *
+ *	Résolution des collisions par redistribution quadratique. Les octets des clefs sont rangés bout à bout dans un
+ *	seul tableau possédé par la table.
+ *
+ */
+
+#ifndef TABLEHACHAGECHAINES_H_
+#define TABLEHACHAGECHAINES_H_
+
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <vector>
+#include "OutilsHachage.h"
+
+namespace labTableHachage {
+
+/**
+ * \class TableHachageChaines
+ *
+ * \brief classe générique représentant une table de dispersion en adressage ouvert dont les clefs sont des chaînes
+ * internées dans une arène de caractères contiguë
+ *
+ *  Chaque entrée conserve, au lieu d'une std::string, la position et la longueur de sa clef dans l'arène ainsi que
+ *  le hash primaire de la clef. Le sondage ne compare les octets d'une clef (memcmp dans l'arène) que si le hash et
+ *  la longueur correspondent, et le rehachage replace les entrées à partir du hash conservé sans lire aucune clef.
+ *  Aucune clef n'est allouée séparément: l'arène grandit comme un vector.
+ *
+ *  Les clefs enlevées laissent leurs octets dans l'arène. Lorsque ces octets morts forment plus de la moitié de
+ *  l'arène, un retrait recopie les clefs vivantes dans une nouvelle arène, sans rien rehacher. L'arène est limitée
+ *  à 4 Gio. Les entrées effacées sont comptées, et la table est reconstruite à la même capacité avant que les
+ *  entrées occupées et effacées ne dépassent les positions que le sondage visite.
+ *
+ * TypeElement : le type des éléments
+ * FoncteurHachage: foncteur de hachage de chaînes pour des capacités premières, par exemple HacheurQuadStr3. En plus
+ * de la spécification de FoncteurHachage.hpp, il doit offrir les méthodes primaire(clef) et indice(hash, n) et
+ * accepter des clefs std::string_view.
+ */
+
+    template<typename TypeElement, class FoncteurHachage>
+    class TableHachageChaines {
+    public:
+
+        TableHachageChaines(size_t = 100);
+
+        void inserer(std::string_view, const TypeElement &);
+
+        void enlever(std::string_view);
+
+        bool contient(std::string_view) const;
+
+        TypeElement element(std::string_view) const;
+
+        TypeElement *trouver(std::string_view);
+
+        const TypeElement *trouver(std::string_view) const;
+
+        void rehacher();
+
+        void vider();
+
+        int taille() const;
+
+        size_t octetsClefs() const;
+
+        double statistiques() const;
+
+        void afficher(std::ostream &) const;
+
+        template<typename TElement, class FHachage>
+        friend std::ostream &operator<<(std::ostream &, const TableHachageChaines<TElement, FHachage> &);
+
+    private:
+
+        /**
+         * \enum Position
+         * \brief Les positions réservées qui marquent une entrée sans clef. Toute autre position est celle de la clef
+         * d'une entrée occupée dans l'arène.
+         */
+        enum Position : uint32_t {
+            VACANT = 0xFFFFFFFF, /*!< l'entrée n'a jamais été utilisé*/
+            EFFACE = 0xFFFFFFFE /*!< l'entrée a été utilisée mais ne l'est plus actuellement*/
+        };
+
+        /**
+         * \struct EntreeChaine
+         *
+         * \brief Entrée de la table: la clef y est représentée par sa position dans l'arène
+         */
+        struct EntreeChaine {
+            uint64_t m_hash; /*!< le hash primaire de la clef */
+            uint32_t m_position; /*!< la position de la clef dans l'arène, VACANT ou EFFACE */
+            uint32_t m_longueur; /*!< la longueur de la clef en octets */
+            TypeElement m_el; /*!< la valeur associée à la clé*/
+
+            EntreeChaine() :
+                    m_hash(0), m_position(VACANT), m_longueur(0), m_el() {
+            }
+        };
+
+        /**
+         * \struct ResultatSondage
+         *
+         * \brief Résultat d'une seule séquence de sondage pour une clef
+         */
+        struct ResultatSondage {
+            size_t index; /*!< la position de la clef, ou la position où l'insérer */
+            bool trouvee; /*!< true si la clef est présente à index */
+            size_t collisions; /*!< le nombre d'entrées occupées rencontrées avant la position libre */
+        };
+
+        // Attributs
+
+        size_t m_tailleTable;
+        std::vector<EntreeChaine> m_tab; /*!< La table de hachage */
+        std::vector<char> m_arene; /*!< Les octets des clefs, bout à bout */
+        size_t m_octetsMorts; /*!< Le nombre d'octets de l'arène qui appartiennent à des clefs enlevées */
+        size_t m_cardinalite; /*!< Le nombre d'éléments actifs dans la table */
+        size_t m_nEffaces; /*!< Le nombre d'entrées effacées dans la table */
+        static const int TAUX_MAX = 50; /*!< Taux de remplissage maximum dans la table */
+        /*! Taux maximum d'entrées occupées ou effacées dans la table, à mi-chemin entre TAUX_MAX et la couverture */
+        static const int TAUX_MAX_UTILISEES = (TAUX_MAX + CouvertureSondage<FoncteurHachage>::value) / 2;
+        FoncteurHachage m_hachage; /*!< Foncteur de hachage */
+
+        unsigned long m_nInsertions /*!< Nombre d'insertions au total*/;
+        unsigned long m_nCollisions; /*!< Le nombre de collisions au total*/
+
+        // Méthodes privées
+
+        std::string_view _clef(const EntreeChaine &) const;
+
+        ResultatSondage _sonder(std::string_view, size_t) const;
+
+        size_t _sonderPositionLibre(size_t) const;
+
+        void _placer(const ResultatSondage &, size_t, uint32_t, uint32_t, const TypeElement &);
+
+        void _compacterArene();
+
+        void _reconstruire(size_t);
+
+        bool _doitEtreRehachee() const;
+
+        bool _doitEtreCompactee() const;
+
+        bool _estVacante(size_t) const;
+
+        bool _estEffacee(size_t) const;
+
+        bool _estOccupee(size_t) const;
+
+        void _statistiques(const unsigned long &);
+    };
+} //Fin du namespace
+
+#include "TableHachageChaines.hpp"
+
+#endif
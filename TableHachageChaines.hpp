@@ -0,0 +1,423 @@
+#include "ContratException.h"
+#include "OutilsHachage.h"
+#include <string_view>
+#include <vector>
+
+namespace labTableHachage {
+
+    /**
+     * @brief Constructeur
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param n La cardinalité approximative du tableau de la table de dispersion.  Cette cardinalité sera en fait
+     * le nombre premier suivant n.
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    TableHachageChaines<TypeElement, FoncteurHachage>::TableHachageChaines(size_t n) :
+            m_tailleTable(prochainPremier(n)),
+            m_tab(m_tailleTable),
+            m_octetsMorts(0),
+            m_cardinalite(0),
+            m_nEffaces(0),
+            m_hachage(m_tailleTable),
+            m_nInsertions(0), m_nCollisions(0) {}
+
+    /**
+     * @brief Ajoute une paire clef-valeur dans la table de dispersion. Les octets de la clef sont copiés à la fin de
+     * l'arène. La table est ensuite rehachée, ou reconstruite à la même capacité si elle contient trop d'entrées
+     * effacées. Une reconstruction qui libérerait moins d'un seizième de la table est remplacée par un agrandissement,
+     * comme dans TableHachage.
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur de la paire clef-valeur
+     * @except PreconditionException si la clef est déjà présente ou si l'arène dépasserait 4 Gio
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    void TableHachageChaines<TypeElement, FoncteurHachage>::inserer(std::string_view clef, const TypeElement &element) {
+        size_t hash = m_hachage.primaire(clef);
+        ResultatSondage resultat = _sonder(clef, hash);
+        PRECONDITION(!resultat.trouvee);
+        PRECONDITION(m_arene.size() + clef.size() < EFFACE);
+        uint32_t position = static_cast<uint32_t>(m_arene.size());
+        m_arene.insert(m_arene.end(), clef.begin(), clef.end());
+        _placer(resultat, hash, position, static_cast<uint32_t>(clef.size()), element);
+        if (_doitEtreRehachee()) {
+            rehacher();
+        } else if (_doitEtreCompactee()) {
+            if (16 * m_nEffaces < m_tailleTable) rehacher();
+            else _reconstruire(m_tailleTable);
+        }
+    }
+
+    /**
+     * @brief Retirer une paire clef-valeur de la table de dispersion. Compacte l'arène si les octets des clefs
+     * enlevées en forment plus de la moitié.
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clé de la paire clef-valeur à retirer
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    void TableHachageChaines<TypeElement, FoncteurHachage>::enlever(std::string_view clef) {
+        ResultatSondage resultat = _sonder(clef, m_hachage.primaire(clef));
+        PRECONDITION(resultat.trouvee);
+        m_tab[resultat.index].m_position = EFFACE;
+        m_octetsMorts += m_tab[resultat.index].m_longueur;
+        --m_cardinalite;
+        ++m_nEffaces;
+        if (2 * m_octetsMorts > m_arene.size()) _compacterArene();
+    }
+
+    /**
+     * @brief Vérifie la présence d'une paire clef-valeur dans la table, à partir de la clef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef la clef de la paire clef-valeur cherchée
+     * @return true si la clef est présente dans la table
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    bool TableHachageChaines<TypeElement, FoncteurHachage>::contient(std::string_view clef) const {
+        return _sonder(clef, m_hachage.primaire(clef)).trouvee;
+    }
+
+    /**
+     * @brief Retourne la valeur correspondant à une clef donnée
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return La valeur correspondant à la clef
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    TypeElement TableHachageChaines<TypeElement, FoncteurHachage>::element(std::string_view clef) const {
+        ResultatSondage resultat = _sonder(clef, m_hachage.primaire(clef));
+        PRECONDITION(resultat.trouvee);
+        return m_tab[resultat.index].m_el;
+    }
+
+    /**
+     * @brief Cherche la valeur correspondant à une clef en une seule séquence de sondage
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    TypeElement *TableHachageChaines<TypeElement, FoncteurHachage>::trouver(std::string_view clef) {
+        ResultatSondage resultat = _sonder(clef, m_hachage.primaire(clef));
+        return resultat.trouvee ? &m_tab[resultat.index].m_el : nullptr;
+    }
+
+    /**
+     * @brief Version constante de trouver
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    const TypeElement *TableHachageChaines<TypeElement, FoncteurHachage>::trouver(std::string_view clef) const {
+        ResultatSondage resultat = _sonder(clef, m_hachage.primaire(clef));
+        return resultat.trouvee ? &m_tab[resultat.index].m_el : nullptr;
+    }
+
+    /**
+     * @brief Agrandit la table lorsque qu'un certain taux d'occupation est atteint. Les entrées sont replacées à
+     * partir de leur hash conservé: ni les clefs ni l'arène ne sont lues.
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    void TableHachageChaines<TypeElement, FoncteurHachage>::rehacher() {
+        _reconstruire(prochainPremier(2 * m_tailleTable));
+    }
+
+    /**
+     * @brief Enlève tous les éléments de la table et vide l'arène
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    void TableHachageChaines<TypeElement, FoncteurHachage>::vider() {
+        m_tab.assign(m_tailleTable, EntreeChaine());
+        m_arene.clear();
+        m_octetsMorts = 0;
+        m_cardinalite = 0;
+        m_nEffaces = 0;
+    }
+
+    /**
+     * @brief Donne le nombre d'éléments dans la table
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return Le nombre d'éléments de la table de dispersion
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    int TableHachageChaines<TypeElement, FoncteurHachage>::taille() const {
+        return m_cardinalite;
+    }
+
+    /**
+     * @brief Donne la taille de l'arène, y compris les octets des clefs enlevées qui n'ont pas encore été compactés
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return Le nombre d'octets de clefs dans l'arène
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    size_t TableHachageChaines<TypeElement, FoncteurHachage>::octetsClefs() const {
+        return m_arene.size();
+    }
+
+    /**
+     * @brief Donne le taux moyen de collisions: le nombre total de collisions divisé par le nombre d'insertions
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return Le nombre de collisions divisé par le nombre d'insertions
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    double TableHachageChaines<TypeElement, FoncteurHachage>::statistiques() const {
+        PRECONDITION(taille() > 0);
+        return static_cast<double>(m_nCollisions) / static_cast<double>(m_nInsertions);
+    }
+
+    /**
+     * @brief Insère la liste des paires clé-valeur de la table dans un flux de sortie
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param p_out Le flux de sortie
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    void TableHachageChaines<TypeElement, FoncteurHachage>::afficher(std::ostream &p_out) const {
+        p_out << "{";
+        for (size_t i = 0; i < m_tailleTable; ++i) {
+            if (_estOccupee(i)) {
+                p_out << "(" << _clef(m_tab[i]) << "," << m_tab[i].m_el << "),";
+            }
+        }
+        p_out << "}";
+    }
+
+    /**
+     * @brief Opérateur d'insertion dans un flux de sortie
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param p_out
+     * @param p_source
+     * @return
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    std::ostream &operator<<(std::ostream &p_out, const TableHachageChaines<TypeElement, FoncteurHachage> &p_source) {
+        p_source.afficher(p_out);
+        return p_out;
+    }
+
+    /**
+     * @brief Donne la clef d'une entrée occupée, qui désigne ses octets dans l'arène
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param entree Une entrée occupée de la table
+     * @return La clef de l'entrée, valide jusqu'à la prochaine insertion ou au prochain retrait
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    std::string_view TableHachageChaines<TypeElement, FoncteurHachage>::_clef(const EntreeChaine &entree) const {
+        return std::string_view(m_arene.data() + entree.m_position, entree.m_longueur);
+    }
+
+    /**
+     * @brief Parcourt une seule fois la séquence de sondage d'une clef. Les octets d'une clef de l'arène ne sont
+     * comparés que si le hash conservé et la longueur de l'entrée correspondent.
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef souhaitée
+     * @param hash Le hash primaire de la clef
+     * @return La position de la clef si elle est présente, sinon la première position libre de sa séquence
+     * @except AssertionError si un nombre excessif de collisions est rencontré
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    typename TableHachageChaines<TypeElement, FoncteurHachage>::ResultatSondage
+    TableHachageChaines<TypeElement, FoncteurHachage>::_sonder(std::string_view clef, size_t hash) const {
+        size_t index = m_hachage.indice(hash, 0);
+        size_t tentative = 1;
+        bool libreTrouvee = false;
+        ResultatSondage resultat = {0, false, 0};
+        while (!_estVacante(index)) {
+            const EntreeChaine &entree = m_tab[index];
+            if (_estOccupee(index)) {
+                if (entree.m_hash == hash && entree.m_longueur == clef.size() && _clef(entree) == clef) {
+                    resultat.index = index;
+                    resultat.trouvee = true;
+                    return resultat;
+                }
+            } else if (!libreTrouvee && _estEffacee(index)) {
+                libreTrouvee = true;
+                resultat.index = index;
+                resultat.collisions = tentative - 1;
+            }
+            index = m_hachage.indice(hash, tentative);
+            ++tentative;
+            ASSERTION(tentative < MAX_TENTATIVES);
+        }
+        if (!libreTrouvee) {
+            resultat.index = index;
+            resultat.collisions = tentative - 1;
+        }
+        return resultat;
+    }
+
+    /**
+     * @brief Trouve la première position vacante de la séquence de sondage d'un hash, pour replacer une entrée
+     * pendant un rehachage, où la table neuve ne contient ni la clef ni d'entrée effacée
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param hash Le hash primaire conservé de l'entrée
+     * @return La première position vacante de la séquence
+     * @except AssertionError si un nombre excessif de collisions est rencontré
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    size_t TableHachageChaines<TypeElement, FoncteurHachage>::_sonderPositionLibre(size_t hash) const {
+        size_t index = m_hachage.indice(hash, 0);
+        size_t tentative = 1;
+        while (!_estVacante(index)) {
+            index = m_hachage.indice(hash, tentative);
+            ++tentative;
+            ASSERTION(tentative < MAX_TENTATIVES);
+        }
+        return index;
+    }
+
+    /**
+     * @brief Place une nouvelle paire clef-valeur à la position libre trouvée par _sonder
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param resultat Le résultat du sondage de la clef, qui ne doit pas avoir été trouvée
+     * @param hash Le hash primaire de la clef
+     * @param position La position de la clef dans l'arène
+     * @param longueur La longueur de la clef
+     * @param element La valeur de la paire clef-valeur
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    void TableHachageChaines<TypeElement, FoncteurHachage>::_placer(const ResultatSondage &resultat, size_t hash,
+                                                                    uint32_t position, uint32_t longueur,
+                                                                    const TypeElement &element) {
+        EntreeChaine &entree = m_tab[resultat.index];
+        if (entree.m_position == EFFACE) --m_nEffaces;
+        entree.m_hash = hash;
+        entree.m_position = position;
+        entree.m_longueur = longueur;
+        entree.m_el = element;
+        ++m_cardinalite;
+        _statistiques(resultat.collisions);
+    }
+
+    /**
+     * @brief Recopie les clefs des entrées occupées dans une nouvelle arène, sans leurs octets morts, et met à jour
+     * leurs positions. Les entrées restent à leur place dans la table.
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    void TableHachageChaines<TypeElement, FoncteurHachage>::_compacterArene() {
+        std::vector<char> arene;
+        arene.reserve(m_arene.size() - m_octetsMorts);
+        for (EntreeChaine &entree: m_tab) {
+            if (entree.m_position >= EFFACE) continue;
+            std::string_view clef = _clef(entree);
+            entree.m_position = static_cast<uint32_t>(arene.size());
+            arene.insert(arene.end(), clef.begin(), clef.end());
+        }
+        m_arene.swap(arene);
+        m_octetsMorts = 0;
+    }
+
+    /**
+     * @brief Replace les entrées occupées dans une table neuve de capacité donnée, à partir de leur hash conservé: ni
+     * les clefs ni l'arène ne sont lues. Les entrées effacées disparaissent.
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param capacite La nouvelle capacité, un nombre premier
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    void TableHachageChaines<TypeElement, FoncteurHachage>::_reconstruire(size_t capacite) {
+        std::vector<EntreeChaine> ancienne;
+        ancienne.swap(m_tab);
+        m_tailleTable = capacite;
+        m_tab.resize(m_tailleTable);
+        m_hachage = FoncteurHachage(m_tailleTable);
+        m_nEffaces = 0;
+        for (const EntreeChaine &entree: ancienne) {
+            if (entree.m_position >= EFFACE) continue;
+            m_tab[_sonderPositionLibre(entree.m_hash)] = entree;
+        }
+    }
+
+    /**
+     * @brief Indique si le taux d'occupation de la table est supérieur à TAUX_MAX
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return true si le taux d'occupation de la table est supérieur à TAUX_MAX
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    bool TableHachageChaines<TypeElement, FoncteurHachage>::_doitEtreRehachee() const {
+        return 100 * m_cardinalite > TAUX_MAX * m_tailleTable;
+    }
+
+    /**
+     * @brief Indique si les entrées occupées et effacées dépassent ensemble TAUX_MAX_UTILISEES de la table
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return true si la table doit être reconstruite pour éliminer ses entrées effacées
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    bool TableHachageChaines<TypeElement, FoncteurHachage>::_doitEtreCompactee() const {
+        return 100 * (m_cardinalite + m_nEffaces) > TAUX_MAX_UTILISEES * m_tailleTable;
+    }
+
+    /**
+     * @brief Indique si un index donnée indique une position vacante
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param i
+     * @return true si la table est vacante en position i
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    bool TableHachageChaines<TypeElement, FoncteurHachage>::_estVacante(size_t i) const {
+        return m_tab[i].m_position == VACANT;
+    }
+
+    /**
+     * @brief Indique si un index donné pointe à une position effacée
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param i Un index dans la table
+     * @return true si la table est effacée en position i
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    bool TableHachageChaines<TypeElement, FoncteurHachage>::_estEffacee(size_t i) const {
+        return m_tab[i].m_position == EFFACE;
+    }
+
+    /**
+     * @brief Indique si un index donné pointe à une position active
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param i un index dans la table
+     * @return true si la table est occupée à la position i
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    bool TableHachageChaines<TypeElement, FoncteurHachage>::_estOccupee(size_t i) const {
+        return m_tab[i].m_position < EFFACE;
+    }
+
+    /**
+     * @brief À chaque appel de _placer, incrément le nombre d'insertions de 1 et le nombre de collisions
+     * du nombre spécifié.
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param collisions Le nombre de collisions rencontré lors de la tentative de trouver un index libre
+     */
+    template<typename TypeElement, class FoncteurHachage>
+    void TableHachageChaines<TypeElement, FoncteurHachage>::_statistiques(const size_t &collisions) {
+        m_nCollisions += collisions;
+        ++m_nInsertions;
+    }
+
+} //Fin du namespace
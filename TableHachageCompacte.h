@@ -0,0 +1,137 @@
+/**
+ * \file TableHachageCompacte.h
+ * \brief Classe définissant une table de hachage à stockage en structure de tableaux.
+ * \version 0.4
+ * \date octobre 2026
+ *
+ *	Résolution des collisions par redistribution quadratique. Les clefs, les éléments et l'état des entrées sont
+ *	rangés dans trois tableaux distincts.
+ *
+ */
+
+#ifndef TABLEHACHAGECOMPACTE_H_
+#define TABLEHACHAGECOMPACTE_H_
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include "OutilsHachage.h"
+
+namespace labTableHachage {
+
+/**
+ * \class TableHachageCompacte
+ *
+ * \brief classe générique représentant une table de dispersion en adressage ouvert dont l'état des entrées est
+ * conservé dans un tableau d'octets de contrôle séparé des clefs et des éléments
+ *
+ *  Chaque position de la table a un octet de contrôle: VACANT, EFFACE, ou, pour une entrée occupée, 7 bits tirés
+ *  du hash primaire de la clef. Le sondage ne lit que les octets de contrôle tant que le fragment du hash ne
+ *  correspond pas, et ne compare les clefs que lorsqu'il correspond. Les entrées effacées sont comptées et compactées
+ *  sur place, comme dans TableHachage, avant que les entrées occupées et effacées ne dépassent les positions que le
+ *  sondage visite.
+ *
+ * TypeClef : le type des clefs
+ * TypeElement : le type des éléments
+ * FoncteurHachage: foncteur de hachage. En plus de la spécification de FoncteurHachage.hpp, il doit offrir les
+ * méthodes primaire(clef) et indice(hash, n).
+ */
+
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    class TableHachageCompacte {
+    public:
+
+        TableHachageCompacte(size_t = 100);
+
+        void inserer(const TypeClef &, const TypeElement &);
+
+        void enlever(const TypeClef &);
+
+        bool contient(const TypeClef &) const;
+
+        TypeElement element(const TypeClef &) const;
+
+        TypeElement *trouver(const TypeClef &);
+
+        const TypeElement *trouver(const TypeClef &) const;
+
+        void rehacher();
+
+        void vider();
+
+        int taille() const;
+
+        double statistiques() const;
+
+        void afficher(std::ostream &) const;
+
+        template<typename TClef, typename TElement, class FHachage>
+        friend std::ostream &operator<<(std::ostream &,
+                                        const TableHachageCompacte<TClef, TElement, FHachage> &);
+
+    private:
+
+        /**
+         * \enum Controle
+         * \brief Les octets de contrôle réservés. Une entrée occupée a un octet de contrôle entre 0 et 127.
+         */
+        enum Controle : uint8_t {
+            VACANT = 0x80, /*!< l'entrée n'a jamais été utilisé*/
+            A_REPLACER = 0xFD, /*!< l'entrée est occupée et attend d'être replacée par un compactage en cours*/
+            EFFACE = 0xFE /*!< l'entrée a été utilisée mais ne l'est plus actuellement*/
+        };
+
+        /**
+         * \struct ResultatSondage
+         *
+         * \brief Résultat d'une seule séquence de sondage pour une clef
+         */
+        struct ResultatSondage {
+            size_t index; /*!< la position de la clef, ou la position où l'insérer */
+            bool trouvee; /*!< true si la clef est présente à index */
+            size_t collisions; /*!< le nombre d'entrées occupées rencontrées avant la position libre */
+        };
+
+        // Attributs
+
+        size_t m_tailleTable;
+        std::vector<uint8_t> m_controle; /*!< Les octets de contrôle, un par position */
+        std::vector<TypeClef> m_clefs; /*!< Les clefs, une par position */
+        std::vector<TypeElement> m_elements; /*!< Les éléments, un par position */
+        size_t m_cardinalite; /*!< Le nombre d'éléments actifs dans la table */
+        size_t m_nEffaces; /*!< Le nombre d'entrées effacées dans la table */
+        static const int TAUX_MAX = 50; /*!< Taux de remplissage maximum dans la table */
+        /*! Taux maximum d'entrées occupées ou effacées dans la table, à mi-chemin entre TAUX_MAX et la couverture */
+        static const int TAUX_MAX_UTILISEES = (TAUX_MAX + CouvertureSondage<FoncteurHachage>::value) / 2;
+        FoncteurHachage m_hachage; /*!< Foncteur de hachage */
+
+        unsigned long m_nInsertions /*!< Nombre d'insertions au total*/;
+        unsigned long m_nCollisions; /*!< Le nombre de collisions au total*/
+
+        // Méthodes privées
+
+        static uint8_t _fragment(size_t);
+
+        ResultatSondage _sonder(const TypeClef &, size_t) const;
+
+        void _placer(const ResultatSondage &, size_t, const TypeClef &, const TypeElement &);
+
+        bool _doitEtreRehachee() const;
+
+        bool _doitEtreCompactee() const;
+
+        void _compacter();
+
+        bool _estVacante(size_t) const;
+
+        bool _estEffacee(size_t) const;
+
+        bool _estOccupee(size_t) const;
+
+        void _statistiques(const unsigned long &);
+    };
+} //Fin du namespace
+
+#include "TableHachageCompacte.hpp"
+
+#endif
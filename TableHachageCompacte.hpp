@@ -0,0 +1,424 @@
+#include "ContratException.h"
+#include "OutilsHachage.h"
+#include <utility>
+#include <vector>
+
+namespace labTableHachage {
+
+    /**
+     * @brief Constructeur
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param n La cardinalité approximative des tableaux de la table de dispersion.  Cette cardinalité sera en fait
+     * le nombre premier suivant n.
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::TableHachageCompacte(size_t n) :
+            m_tailleTable(prochainPremier(n)),
+            m_controle(m_tailleTable, VACANT),
+            m_clefs(m_tailleTable),
+            m_elements(m_tailleTable),
+            m_cardinalite(0),
+            m_nEffaces(0),
+            m_hachage(m_tailleTable),
+            m_nInsertions(0), m_nCollisions(0) {}
+
+    /**
+     * @brief Ajoute une paire clef-valeur dans la table de dispersion, puis rehache ou compacte la table au besoin. Un
+     * compactage qui libérerait moins d'un seizième de la table est remplacé par un agrandissement, comme dans
+     * TableHachage.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur de la paire clef-valeur
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::inserer(const TypeClef &clef,
+                                                                               const TypeElement &element) {
+        size_t hash = m_hachage.primaire(clef);
+        ResultatSondage resultat = _sonder(clef, hash);
+        PRECONDITION(!resultat.trouvee);
+        _placer(resultat, hash, clef, element);
+        if (_doitEtreRehachee()) {
+            rehacher();
+        } else if (_doitEtreCompactee()) {
+            if (16 * m_nEffaces < m_tailleTable) rehacher();
+            else _compacter();
+        }
+    }
+
+    /**
+     * @brief Retirer une paire clef-valeur de la table de dispersion
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clé de la paire clef-valeur à retirer
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::enlever(const TypeClef &clef) {
+        ResultatSondage resultat = _sonder(clef, m_hachage.primaire(clef));
+        PRECONDITION(resultat.trouvee);
+        m_controle[resultat.index] = EFFACE;
+        --m_cardinalite;
+        ++m_nEffaces;
+    }
+
+    /**
+     * @brief Vérifie la présence d'une paire clef-valeur dans la table, à partir de la clef
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef la clef de la paire clef-valeur cherchée
+     * @return true si la clef est présente dans la table
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::contient(const TypeClef &clef) const {
+        return _sonder(clef, m_hachage.primaire(clef)).trouvee;
+    }
+
+    /**
+     * @brief Retourne la valeur correspondant à une clef donnée
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return La valeur correspondant à la clef
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    TypeElement TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::element(const TypeClef &clef) const {
+        ResultatSondage resultat = _sonder(clef, m_hachage.primaire(clef));
+        PRECONDITION(resultat.trouvee);
+        return m_elements[resultat.index];
+    }
+
+    /**
+     * @brief Cherche la valeur correspondant à une clef en une seule séquence de sondage
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    TypeElement *TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::trouver(const TypeClef &clef) {
+        ResultatSondage resultat = _sonder(clef, m_hachage.primaire(clef));
+        return resultat.trouvee ? &m_elements[resultat.index] : nullptr;
+    }
+
+    /**
+     * @brief Version constante de trouver
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    const TypeElement *
+    TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::trouver(const TypeClef &clef) const {
+        ResultatSondage resultat = _sonder(clef, m_hachage.primaire(clef));
+        return resultat.trouvee ? &m_elements[resultat.index] : nullptr;
+    }
+
+    /**
+     * @brief Agrandit la table lorsque qu'un certain taux d'occupation est atteint
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::rehacher() {
+        std::vector<uint8_t> ancienControle;
+        std::vector<TypeClef> anciennesClefs;
+        std::vector<TypeElement> anciensElements;
+        ancienControle.swap(m_controle);
+        anciennesClefs.swap(m_clefs);
+        anciensElements.swap(m_elements);
+        m_tailleTable = prochainPremier(2 * m_tailleTable);
+        m_controle.assign(m_tailleTable, VACANT);
+        m_clefs.resize(m_tailleTable);
+        m_elements.resize(m_tailleTable);
+        m_hachage = FoncteurHachage(m_tailleTable);
+        m_cardinalite = 0;
+        m_nEffaces = 0;
+        for (size_t i = 0; i < ancienControle.size(); ++i) {
+            if (ancienControle[i] & VACANT) continue;
+            size_t hash = m_hachage.primaire(anciennesClefs[i]);
+            _placer(_sonder(anciennesClefs[i], hash), hash, anciennesClefs[i], anciensElements[i]);
+        }
+    }
+
+    /**
+     * @brief Enlève tous les éléments de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::vider() {
+        m_controle.assign(m_tailleTable, VACANT);
+        m_cardinalite = 0;
+        m_nEffaces = 0;
+    }
+
+    /**
+     * @brief Donne le nombre d'éléments dans la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return Le nombre d'éléments de la table de dispersion
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    int TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::taille() const {
+        return m_cardinalite;
+    }
+
+    /**
+     * @brief Donne le taux moyen de collisions: le nombre total de collisions divisé par le nombre d'insertions
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return Le nombre de collisions divisé par le nombre d'insertions
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    double TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::statistiques() const {
+        PRECONDITION(taille() > 0);
+        return static_cast<double>(m_nCollisions) / static_cast<double>(m_nInsertions);
+    }
+
+    /**
+     * @brief Insère la liste des paires clé-valeur de la table dans un flux de sortie
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param p_out Le flux de sortie
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::afficher(std::ostream &p_out) const {
+        p_out << "{";
+        for (size_t i = 0; i < m_tailleTable; ++i) {
+            if (_estOccupee(i)) {
+                p_out << "(" << m_clefs[i] << "," << m_elements[i] << "),";
+            }
+        }
+        p_out << "}";
+    }
+
+    /**
+     * @brief Opérateur d'insertion dans un flux de sortie
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param p_out
+     * @param p_source
+     * @return
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    std::ostream &operator<<(std::ostream &p_out,
+                             const TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage> &p_source) {
+        p_source.afficher(p_out);
+        return p_out;
+    }
+
+    /**
+     * @brief Tire de 7 bits du hash primaire le fragment conservé dans l'octet de contrôle d'une entrée occupée. Le
+     * hash est d'abord mélangé pour que des hashs primaires faibles (petits entiers) donnent des fragments variés.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param hash Le hash primaire de la clef
+     * @return Un octet entre 0 et 127
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    uint8_t TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::_fragment(size_t hash) {
+        return static_cast<uint8_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> 57);
+    }
+
+    /**
+     * @brief Parcourt une seule fois la séquence de sondage d'une clef. Seuls les octets de contrôle sont lus, sauf
+     * lorsque le fragment du hash correspond: la clef de l'entrée est alors comparée.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef souhaitée
+     * @param hash Le hash primaire de la clef
+     * @return La position de la clef si elle est présente, sinon la première position libre de sa séquence
+     * @except AssertionError si un nombre excessif de collisions est rencontré
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    typename TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::ResultatSondage
+    TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::_sonder(const TypeClef &clef,
+                                                                          size_t hash) const {
+        const uint8_t fragment = _fragment(hash);
+        size_t index = m_hachage.indice(hash, 0);
+        size_t tentative = 1;
+        bool libreTrouvee = false;
+        ResultatSondage resultat = {0, false, 0};
+        while (!_estVacante(index)) {
+            if (m_controle[index] == fragment) {
+                if (m_clefs[index] == clef) {
+                    resultat.index = index;
+                    resultat.trouvee = true;
+                    return resultat;
+                }
+            } else if (!libreTrouvee && _estEffacee(index)) {
+                libreTrouvee = true;
+                resultat.index = index;
+                resultat.collisions = tentative - 1;
+            }
+            index = m_hachage.indice(hash, tentative);
+            ++tentative;
+            ASSERTION(tentative < MAX_TENTATIVES);
+        }
+        if (!libreTrouvee) {
+            resultat.index = index;
+            resultat.collisions = tentative - 1;
+        }
+        return resultat;
+    }
+
+    /**
+     * @brief Place une nouvelle paire clef-valeur à la position libre trouvée par _sonder
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param resultat Le résultat du sondage de la clef, qui ne doit pas avoir été trouvée
+     * @param hash Le hash primaire de la clef
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur de la paire clef-valeur
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::_placer(const ResultatSondage &resultat,
+                                                                               size_t hash, const TypeClef &clef,
+                                                                               const TypeElement &element) {
+        if (_estEffacee(resultat.index)) --m_nEffaces;
+        m_controle[resultat.index] = _fragment(hash);
+        m_clefs[resultat.index] = clef;
+        m_elements[resultat.index] = element;
+        ++m_cardinalite;
+        _statistiques(resultat.collisions);
+    }
+
+    /**
+     * @brief Indique si un index donnée indique une position vacante
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param i
+     * @return true si la table est vacante en position i
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::_estVacante(size_t i) const {
+        return m_controle[i] == VACANT;
+    }
+
+    /**
+     * @brief Indique si un index donné pointe à une position effacée
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param i Un index dans la table
+     * @return true si la table est effacée en position i
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::_estEffacee(size_t i) const {
+        return m_controle[i] == EFFACE;
+    }
+
+    /**
+     * @brief Indique si un index donné pointe à une position active
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param i un index dans la table
+     * @return true si la table est occupée à la position i
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::_estOccupee(size_t i) const {
+        return !(m_controle[i] & VACANT);
+    }
+
+    /**
+     * @brief Indique si le taux d'occupation de la table est supérieur à TAUX_MAX
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return true si le taux d'occupation de la table est supérieur à TAUX_MAX
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::_doitEtreRehachee() const {
+        return 100 * m_cardinalite > TAUX_MAX * m_tailleTable;
+    }
+
+    /**
+     * @brief Indique si les entrées occupées et effacées dépassent ensemble TAUX_MAX_UTILISEES de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return true si les entrées effacées doivent être compactées
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::_doitEtreCompactee() const {
+        return 100 * (m_cardinalite + m_nEffaces) > TAUX_MAX_UTILISEES * m_tailleTable;
+    }
+
+    /**
+     * @brief Élimine les entrées effacées sans changer la capacité ni allouer de mémoire, comme
+     * TableHachage::_compacter. Les entrées effacées deviennent vacantes et les entrées occupées sont marquées
+     * A_REPLACER; chacune est ensuite replacée à la première position non occupée de sa séquence de sondage, en
+     * échangeant sa clef et son élément avec ceux d'une autre entrée à replacer au besoin.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @except AssertionError si un nombre excessif de collisions est rencontré
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::_compacter() {
+        for (uint8_t &controle: m_controle) {
+            if (controle == EFFACE) controle = VACANT;
+            else if (!(controle & VACANT)) controle = A_REPLACER;
+        }
+        for (size_t i = 0; i < m_tailleTable; ++i) {
+            while (m_controle[i] == A_REPLACER) {
+                size_t hash = m_hachage.primaire(m_clefs[i]);
+                size_t index = m_hachage.indice(hash, 0);
+                size_t tentative = 1;
+                while (index != i && _estOccupee(index)) {
+                    index = m_hachage.indice(hash, tentative);
+                    ++tentative;
+                    ASSERTION(tentative < MAX_TENTATIVES);
+                }
+                if (index == i) {
+                    m_controle[i] = _fragment(hash);
+                } else if (_estVacante(index)) {
+                    m_clefs[index] = std::move(m_clefs[i]);
+                    m_elements[index] = std::move(m_elements[i]);
+                    m_controle[index] = _fragment(hash);
+                    m_controle[i] = VACANT;
+                } else {
+                    std::swap(m_clefs[i], m_clefs[index]);
+                    std::swap(m_elements[i], m_elements[index]);
+                    m_controle[index] = _fragment(hash);
+                }
+            }
+        }
+        m_nEffaces = 0;
+    }
+
+    /**
+     * @brief À chaque appel de _placer, incrément le nombre d'insertions de 1 et le nombre de collisions
+     * du nombre spécifié.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param collisions Le nombre de collisions rencontré lors de la tentative de trouver un index libre
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageCompacte<TypeClef, TypeElement, FoncteurHachage>::_statistiques(const size_t &collisions) {
+        m_nCollisions += collisions;
+        ++m_nInsertions;
+    }
+
+} //Fin du namespace
@@ -0,0 +1,105 @@
+/**
+ * \file TableHachageConcurrente.h
+ * \brief Classe définissant une table de hachage utilisable par plusieurs fils d'exécution à la fois.
+ * \version 0.4
+ * \date octobre 2026
+ *
+ *	Résolution des collisions par redistribution quadratique, comme TableHachage. La table est partagée en segments
+ *	indépendants, chacun protégé par son propre verrou lecteurs-rédacteur.
+ *
+ */
+
+#ifndef TABLEHACHAGECONCURRENTE_H_
+#define TABLEHACHAGECONCURRENTE_H_
+
+#include <memory>
+#include <shared_mutex>
+#include "TableHachage.h"
+
+namespace labTableHachage {
+
+/**
+ * \class TableHachageConcurrente
+ *
+ * \brief classe générique représentant une table de dispersion en adressage ouvert partagée en segments verrouillés
+ * séparément
+ *
+ *  Chaque clef appartient à un seul segment, choisi à partir de son hash primaire. Un segment est une TableHachage
+ *  protégée par un std::shared_mutex: les recherches d'un même segment se font en parallèle, et une modification ne
+ *  bloque que son segment. Chaque segment se rehache indépendamment des autres, sous son propre verrou.
+ *
+ *  Comme une valeur peut être modifiée ou déplacée par un autre fil dès que le verrou est relâché, les recherches
+ *  retournent des copies des valeurs plutôt que des références ou des pointeurs.
+ *
+ * TypeClef : le type des clefs
+ * TypeElement : le type des éléments
+ * FoncteurHachage: foncteur de hachage. En plus de la spécification de FoncteurHachage.hpp, il doit offrir la
+ * méthode primaire(clef), qui choisit le segment.
+ * PolitiqueCapacite: choix des capacités de chaque segment, celle du foncteur de hachage comme pour TableHachage.
+ * Voir PolitiquesCapacite.h
+ */
+
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage,
+            class PolitiqueCapacite = typename CapaciteHacheur<FoncteurHachage>::type>
+    class TableHachageConcurrente {
+        static_assert(CapaciteCompatible<FoncteurHachage, PolitiqueCapacite>::value,
+                      "PolitiqueCapacite doit être celle du foncteur de hachage");
+    public:
+
+        TableHachageConcurrente(size_t = 100, size_t = 64);
+
+        void inserer(const TypeClef &, const TypeElement &);
+
+        bool insererOuAssigner(const TypeClef &, const TypeElement &);
+
+        bool insererSiAbsent(const TypeClef &, const TypeElement &);
+
+        template<typename ClefCompatible>
+        void enlever(const ClefCompatible &);
+
+        template<typename ClefCompatible>
+        bool contient(const ClefCompatible &) const;
+
+        template<typename ClefCompatible>
+        TypeElement element(const ClefCompatible &) const;
+
+        template<typename ClefCompatible>
+        bool lire(const ClefCompatible &, TypeElement &) const;
+
+        void vider();
+
+        int taille() const;
+
+        size_t nombreSegments() const;
+
+    private:
+
+        typedef TableHachage<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite> Table;
+
+        /**
+         * \struct Segment
+         *
+         * \brief Une TableHachage et son verrou, alignés sur une ligne de cache pour que les verrous de segments
+         * voisins ne partagent pas la même ligne
+         */
+        struct alignas(64) Segment {
+            mutable std::shared_mutex m_verrou; /*!< verrou partagé par les lectures, exclusif pour les modifications */
+            Table m_table; /*!< les entrées du segment */
+        };
+
+        // Attributs
+
+        size_t m_nSegments; /*!< Le nombre de segments, une puissance de deux */
+        std::unique_ptr<Segment[]> m_segments; /*!< Les segments de la table */
+        FoncteurHachage m_hachage; /*!< Foncteur de hachage, utilisé seulement pour le hash primaire */
+
+        // Méthodes privées
+
+        template<typename ClefCompatible>
+        Segment &_segment(const ClefCompatible &) const;
+    };
+} //Fin du namespace
+
+#include "TableHachageConcurrente.hpp"
+
+#endif
@@ -0,0 +1,230 @@
+#include "ContratException.h"
+#include <mutex>
+#include <shared_mutex>
+
+namespace labTableHachage {
+
+    /**
+     * @brief Constructeur
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param n La capacité approximative de l'ensemble de la table, répartie également entre les segments
+     * @param nSegments Le nombre de segments, arrondi à la puissance de deux suivante. Il borne le nombre de fils qui
+     * peuvent modifier la table en même temps.
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::TableHachageConcurrente(
+            size_t n, size_t nSegments) :
+            m_nSegments(1),
+            m_hachage(1) {
+        while (m_nSegments < nSegments) m_nSegments <<= 1;
+        m_segments.reset(new Segment[m_nSegments]);
+        for (size_t i = 0; i < m_nSegments; ++i) m_segments[i].m_table = Table(n / m_nSegments + 1);
+    }
+
+    /**
+     * @brief Ajoute une paire clef-valeur dans la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur de la paire clef-valeur
+     * @except PreconditionException si la clef est déjà présente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::inserer(
+            const TypeClef &clef, const TypeElement &element) {
+        Segment &segment = _segment(clef);
+        std::unique_lock<std::shared_mutex> verrou(segment.m_verrou);
+        segment.m_table.inserer(clef, element);
+    }
+
+    /**
+     * @brief Insère la paire clef-valeur si la clef est absente, sinon remplace la valeur associée à la clef
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur à associer à la clef
+     * @return true si la paire a été insérée, false si une valeur existante a été remplacée
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    bool TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::insererOuAssigner(
+            const TypeClef &clef, const TypeElement &element) {
+        Segment &segment = _segment(clef);
+        std::unique_lock<std::shared_mutex> verrou(segment.m_verrou);
+        return segment.m_table.insererOuAssigner(clef, element);
+    }
+
+    /**
+     * @brief Insère la paire clef-valeur seulement si la clef est absente
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur à insérer si la clef est absente
+     * @return true si l'insertion a eu lieu
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    bool TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::insererSiAbsent(
+            const TypeClef &clef, const TypeElement &element) {
+        Segment &segment = _segment(clef);
+        std::unique_lock<std::shared_mutex> verrou(segment.m_verrou);
+        return segment.m_table.insererSiAbsent(clef, element).second;
+    }
+
+    /**
+     * @brief Retirer une paire clef-valeur de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clef La clé de la paire clef-valeur à retirer
+     * @except PreconditionException si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    template<typename ClefCompatible>
+    void TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::enlever(
+            const ClefCompatible &clef) {
+        Segment &segment = _segment(clef);
+        std::unique_lock<std::shared_mutex> verrou(segment.m_verrou);
+        segment.m_table.enlever(clef);
+    }
+
+    /**
+     * @brief Vérifie la présence d'une paire clef-valeur dans la table, à partir de la clef
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clef la clef de la paire clef-valeur cherchée
+     * @return true si la clef est présente dans la table
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    template<typename ClefCompatible>
+    bool TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::contient(
+            const ClefCompatible &clef) const {
+        const Segment &segment = _segment(clef);
+        std::shared_lock<std::shared_mutex> verrou(segment.m_verrou);
+        return segment.m_table.contient(clef);
+    }
+
+    /**
+     * @brief Retourne une copie de la valeur correspondant à une clef donnée
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return La valeur correspondant à la clef au moment de la recherche
+     * @except PreconditionException si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    template<typename ClefCompatible>
+    TypeElement TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::element(
+            const ClefCompatible &clef) const {
+        const Segment &segment = _segment(clef);
+        std::shared_lock<std::shared_mutex> verrou(segment.m_verrou);
+        return segment.m_table.element(clef);
+    }
+
+    /**
+     * @brief Copie la valeur correspondant à une clef si elle est présente, en une seule recherche. Contrairement à
+     * contient suivi de element, la clef ne peut pas être retirée par un autre fil entre les deux.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @param element Reçoit la valeur correspondant à la clef, si elle est présente
+     * @return true si la clef est présente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    template<typename ClefCompatible>
+    bool TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::lire(
+            const ClefCompatible &clef, TypeElement &element) const {
+        const Segment &segment = _segment(clef);
+        std::shared_lock<std::shared_mutex> verrou(segment.m_verrou);
+        const TypeElement *trouve = segment.m_table.trouver(clef);
+        if (trouve == nullptr) return false;
+        element = *trouve;
+        return true;
+    }
+
+    /**
+     * @brief Enlève tous les éléments de la table, un segment à la fois
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::vider() {
+        for (size_t i = 0; i < m_nSegments; ++i) {
+            std::unique_lock<std::shared_mutex> verrou(m_segments[i].m_verrou);
+            m_segments[i].m_table.vider();
+        }
+    }
+
+    /**
+     * @brief Donne le nombre d'éléments dans la table. Les segments sont comptés l'un après l'autre: pendant des
+     * modifications concurrentes, le résultat n'est qu'approximatif.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return Le nombre d'éléments de la table de dispersion
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    int TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::taille() const {
+        int total = 0;
+        for (size_t i = 0; i < m_nSegments; ++i) {
+            std::shared_lock<std::shared_mutex> verrou(m_segments[i].m_verrou);
+            total += m_segments[i].m_table.taille();
+        }
+        return total;
+    }
+
+    /**
+     * @brief Donne le nombre de segments de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return Le nombre de segments, une puissance de deux
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    size_t TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::nombreSegments() const {
+        return m_nSegments;
+    }
+
+    /**
+     * @brief Choisit le segment d'une clef. Le hash primaire est d'abord mélangé: les segments utilisent les mêmes
+     * bits faibles du hash pour leurs propres positions, et les clefs d'un segment s'y agglutineraient sinon.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @tparam ClefCompatible TypeClef ou un type de clef compatible, voir TableHachage.h
+     * @param clef La clef
+     * @return Le segment auquel la clef appartient
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    template<typename ClefCompatible>
+    typename TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::Segment &
+    TableHachageConcurrente<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_segment(
+            const ClefCompatible &clef) const {
+        size_t hash = CapacitePuissanceDeux::preparer(m_hachage.primaire(clef));
+        return m_segments[CapacitePuissanceDeux::reduire(hash >> 32, m_nSegments)];
+    }
+
+} //Fin du namespace
@@ -0,0 +1,141 @@
+/**
+ * \file TableHachageGroupes.h
+ * \brief Classe définissant une table de hachage sondée par groupes d'octets de contrôle.
+ * \version 0.4
+ * \date octobre 2026
+ *
+ *	Résolution des collisions par redistribution quadratique sur les groupes. Voir GroupeControle.h pour le choix
+ *	du moteur SIMD.
+ *
+ */
+
+#ifndef TABLEHACHAGEGROUPES_H_
+#define TABLEHACHAGEGROUPES_H_
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include "GroupeControle.h"
+#include "OutilsHachage.h"
+#include "PolitiquesCapacite.h"
+
+namespace labTableHachage {
+
+/**
+ * \class TableHachageGroupes
+ *
+ * \brief classe générique représentant une table de dispersion en adressage ouvert sondée par groupes de
+ * GroupeControle::LARGEUR positions
+ *
+ *  Les octets de contrôle suivent la convention de TableHachageCompacte. Le foncteur de hachage choisit un groupe
+ *  plutôt qu'une position: une seule comparaison SIMD donne les positions du groupe dont le fragment du hash
+ *  correspond à la clef, ainsi que ses positions libres. Une recherche s'arrête au premier groupe qui contient une
+ *  position vacante. Si le sondage visite tous les groupes (HacheurTriang* avec CapacitePuissanceDeux), un seul
+ *  groupe non plein suffit et le taux de remplissage maximum est de 87,5%. Le sondage quadratique sur un nombre
+ *  premier de groupes n'en visite que la moitié: le taux est alors limité à sa couverture, 50%.
+ *
+ * TypeClef : le type des clefs
+ * TypeElement : le type des éléments
+ * FoncteurHachage: foncteur de hachage offrant primaire(clef) et indice(hash, n), construit avec le nombre de groupes
+ * de la table.
+ * PolitiqueCapacite: choix du nombre de groupes (CapacitePremiere ou CapacitePuissanceDeux). Par défaut, celle du
+ * foncteur de hachage, comme pour TableHachage. Voir PolitiquesCapacite.h
+ */
+
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage,
+            class PolitiqueCapacite = typename CapaciteHacheur<FoncteurHachage>::type>
+    class TableHachageGroupes {
+        static_assert(CapaciteCompatible<FoncteurHachage, PolitiqueCapacite>::value,
+                      "PolitiqueCapacite doit être celle du foncteur de hachage");
+    public:
+
+        TableHachageGroupes(size_t = 100);
+
+        void inserer(const TypeClef &, const TypeElement &);
+
+        void enlever(const TypeClef &);
+
+        bool contient(const TypeClef &) const;
+
+        TypeElement element(const TypeClef &) const;
+
+        TypeElement *trouver(const TypeClef &);
+
+        const TypeElement *trouver(const TypeClef &) const;
+
+        void rehacher();
+
+        void vider();
+
+        int taille() const;
+
+        size_t capacite() const;
+
+        double statistiques() const;
+
+        void afficher(std::ostream &) const;
+
+        template<typename TClef, typename TElement, class FHachage, class PCapacite>
+        friend std::ostream &operator<<(std::ostream &,
+                                        const TableHachageGroupes<TClef, TElement, FHachage, PCapacite> &);
+
+    private:
+
+        /**
+         * \enum Controle
+         * \brief Les octets de contrôle réservés. Une entrée occupée a un octet de contrôle entre 0 et 127.
+         */
+        enum Controle : uint8_t {
+            VACANT = 0x80, /*!< l'entrée n'a jamais été utilisé*/
+            EFFACE = 0xFE /*!< l'entrée a été utilisée mais ne l'est plus actuellement*/
+        };
+
+        /**
+         * \struct ResultatSondage
+         *
+         * \brief Résultat d'une seule séquence de sondage pour une clef
+         */
+        struct ResultatSondage {
+            size_t index; /*!< la position de la clef, ou la position où l'insérer */
+            bool trouvee; /*!< true si la clef est présente à index */
+            size_t collisions; /*!< le nombre de groupes sans position libre rencontrés avant la position libre */
+        };
+
+        // Attributs
+
+        size_t m_nGroupes; /*!< Le nombre de groupes, une capacité valide selon PolitiqueCapacite */
+        std::vector<uint8_t> m_controle; /*!< Les octets de contrôle, un par position */
+        std::vector<TypeClef> m_clefs; /*!< Les clefs, une par position */
+        std::vector<TypeElement> m_elements; /*!< Les éléments, un par position */
+        size_t m_cardinalite; /*!< Le nombre d'éléments actifs dans la table */
+        size_t m_nEffaces; /*!< Le nombre de positions effacées */
+        static const int COUVERTURE = CouvertureSondage<FoncteurHachage>::value; /*!< Taux des groupes visités */
+        /*! Taux maximum de positions occupées ou effacées. Si le sondage visite tous les groupes, il suffit qu'une
+         * position soit vacante: 87,5% laisse des positions vacantes et garde les séquences courtes. Sinon, le taux est
+         * la couverture, 50%: au plus la moitié des groupes sont alors pleins, et le sondage, qui en atteint plus de
+         * la moitié, en rencontre un qui ne l'est pas. */
+        static const int TAUX_MAX_POUR_MILLE = COUVERTURE == 100 ? 875 : 10 * COUVERTURE;
+        FoncteurHachage m_hachage; /*!< Foncteur de hachage, sur les groupes */
+
+        unsigned long m_nInsertions /*!< Nombre d'insertions au total*/;
+        unsigned long m_nCollisions; /*!< Le nombre de collisions au total*/
+
+        // Méthodes privées
+
+        static uint8_t _fragment(size_t);
+
+        ResultatSondage _sonder(const TypeClef &, size_t) const;
+
+        void _placer(const ResultatSondage &, size_t, const TypeClef &, const TypeElement &);
+
+        void _reconstruire(size_t);
+
+        bool _doitEtreRehachee() const;
+
+        void _statistiques(const unsigned long &);
+    };
+} //Fin du namespace
+
+#include "TableHachageGroupes.hpp"
+
+#endif
@@ -0,0 +1,381 @@
+#include "ContratException.h"
+#include "OutilsHachage.h"
+#include <vector>
+
+namespace labTableHachage {
+
+    /**
+     * @brief Constructeur
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param n La capacité approximative de la table. Le nombre de groupes sera la capacité valide suivant
+     * n / GroupeControle::LARGEUR selon PolitiqueCapacite.
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::TableHachageGroupes(size_t n) :
+            m_nGroupes(PolitiqueCapacite::capacite(n / GroupeControle::LARGEUR)),
+            m_controle(m_nGroupes * GroupeControle::LARGEUR, VACANT),
+            m_clefs(m_controle.size()),
+            m_elements(m_controle.size()),
+            m_cardinalite(0),
+            m_nEffaces(0),
+            m_hachage(m_nGroupes),
+            m_nInsertions(0), m_nCollisions(0) {}
+
+    /**
+     * @brief Ajoute une paire clef-valeur dans la table de dispersion
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur de la paire clef-valeur
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::inserer(
+            const TypeClef &clef, const TypeElement &element) {
+        size_t hash = m_hachage.primaire(clef);
+        ResultatSondage resultat = _sonder(clef, hash);
+        PRECONDITION(!resultat.trouvee);
+        _placer(resultat, hash, clef, element);
+        if (_doitEtreRehachee()) {
+            if (2 * 1000 * m_cardinalite > TAUX_MAX_POUR_MILLE * capacite()) rehacher();
+            else _reconstruire(m_nGroupes);
+        }
+    }
+
+    /**
+     * @brief Retirer une paire clef-valeur de la table de dispersion. La position redevient vacante si son groupe
+     * contient encore une position vacante, puisqu'aucune séquence de sondage n'a alors pu dépasser ce groupe.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clé de la paire clef-valeur à retirer
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::enlever(const TypeClef &clef) {
+        ResultatSondage resultat = _sonder(clef, m_hachage.primaire(clef));
+        PRECONDITION(resultat.trouvee);
+        size_t debutGroupe = resultat.index - resultat.index % GroupeControle::LARGEUR;
+        if (GroupeControle(&m_controle[debutGroupe]).vacantes()) {
+            m_controle[resultat.index] = VACANT;
+        } else {
+            m_controle[resultat.index] = EFFACE;
+            ++m_nEffaces;
+        }
+        --m_cardinalite;
+    }
+
+    /**
+     * @brief Vérifie la présence d'une paire clef-valeur dans la table, à partir de la clef
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef la clef de la paire clef-valeur cherchée
+     * @return true si la clef est présente dans la table
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    bool TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::contient(
+            const TypeClef &clef) const {
+        return _sonder(clef, m_hachage.primaire(clef)).trouvee;
+    }
+
+    /**
+     * @brief Retourne la valeur correspondant à une clef donnée
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return La valeur correspondant à la clef
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    TypeElement TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::element(
+            const TypeClef &clef) const {
+        ResultatSondage resultat = _sonder(clef, m_hachage.primaire(clef));
+        PRECONDITION(resultat.trouvee);
+        return m_elements[resultat.index];
+    }
+
+    /**
+     * @brief Cherche la valeur correspondant à une clef en une seule séquence de sondage
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    TypeElement *TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::trouver(
+            const TypeClef &clef) {
+        ResultatSondage resultat = _sonder(clef, m_hachage.primaire(clef));
+        return resultat.trouvee ? &m_elements[resultat.index] : nullptr;
+    }
+
+    /**
+     * @brief Version constante de trouver
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    const TypeElement *
+    TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::trouver(
+            const TypeClef &clef) const {
+        ResultatSondage resultat = _sonder(clef, m_hachage.primaire(clef));
+        return resultat.trouvee ? &m_elements[resultat.index] : nullptr;
+    }
+
+    /**
+     * @brief Agrandit la table au nombre de groupes valide suivant selon PolitiqueCapacite
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::rehacher() {
+        _reconstruire(PolitiqueCapacite::agrandir(m_nGroupes));
+    }
+
+    /**
+     * @brief Enlève tous les éléments de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::vider() {
+        m_controle.assign(m_controle.size(), VACANT);
+        m_cardinalite = 0;
+        m_nEffaces = 0;
+    }
+
+    /**
+     * @brief Donne le nombre d'éléments dans la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return Le nombre d'éléments de la table de dispersion
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    int TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::taille() const {
+        return m_cardinalite;
+    }
+
+    /**
+     * @brief Donne le nombre de positions de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return Le nombre de groupes multiplié par GroupeControle::LARGEUR
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    size_t TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::capacite() const {
+        return m_controle.size();
+    }
+
+    /**
+     * @brief Donne le taux moyen de collisions: le nombre total de groupes pleins traversés divisé par le nombre
+     * d'insertions
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return Le nombre de collisions divisé par le nombre d'insertions
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    double TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::statistiques() const {
+        PRECONDITION(taille() > 0);
+        return static_cast<double>(m_nCollisions) / static_cast<double>(m_nInsertions);
+    }
+
+    /**
+     * @brief Insère la liste des paires clé-valeur de la table dans un flux de sortie
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param p_out Le flux de sortie
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::afficher(
+            std::ostream &p_out) const {
+        p_out << "{";
+        for (size_t i = 0; i < m_controle.size(); ++i) {
+            if (!(m_controle[i] & VACANT)) {
+                p_out << "(" << m_clefs[i] << "," << m_elements[i] << "),";
+            }
+        }
+        p_out << "}";
+    }
+
+    /**
+     * @brief Opérateur d'insertion dans un flux de sortie
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param p_out
+     * @param p_source
+     * @return
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    std::ostream &
+    operator<<(std::ostream &p_out,
+               const TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite> &p_source) {
+        p_source.afficher(p_out);
+        return p_out;
+    }
+
+    /**
+     * @brief Tire de 7 bits du hash primaire le fragment conservé dans l'octet de contrôle d'une entrée occupée
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param hash Le hash primaire de la clef
+     * @return Un octet entre 0 et 127
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    uint8_t TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_fragment(size_t hash) {
+        return static_cast<uint8_t>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >> 57);
+    }
+
+    /**
+     * @brief Parcourt une seule fois la séquence de groupes d'une clef. Chaque groupe est comparé en entier au
+     * fragment du hash; la recherche s'arrête à la clef ou au premier groupe contenant une position vacante.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clef souhaitée
+     * @param hash Le hash primaire de la clef
+     * @return La position de la clef si elle est présente, sinon la première position libre de sa séquence
+     * @except AssertionError si un nombre excessif de collisions est rencontré
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    typename TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::ResultatSondage
+    TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_sonder(
+            const TypeClef &clef, size_t hash) const {
+        const uint8_t fragment = _fragment(hash);
+        bool libreTrouvee = false;
+        ResultatSondage resultat = {0, false, 0};
+        for (size_t tentative = 0;; ++tentative) {
+            ASSERTION(tentative < MAX_TENTATIVES);
+            size_t debutGroupe = m_hachage.indice(hash, tentative) * GroupeControle::LARGEUR;
+            GroupeControle groupe(&m_controle[debutGroupe]);
+            for (uint32_t candidats = groupe.correspondances(fragment); candidats; candidats &= candidats - 1) {
+                size_t index = debutGroupe + premierBit(candidats);
+                if (m_clefs[index] == clef) {
+                    resultat.index = index;
+                    resultat.trouvee = true;
+                    return resultat;
+                }
+            }
+            if (!libreTrouvee) {
+                uint32_t libres = groupe.libres();
+                if (libres) {
+                    libreTrouvee = true;
+                    resultat.index = debutGroupe + premierBit(libres);
+                    resultat.collisions = tentative;
+                }
+            }
+            if (groupe.vacantes()) return resultat;
+        }
+    }
+
+    /**
+     * @brief Place une nouvelle paire clef-valeur à la position libre trouvée par _sonder
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param resultat Le résultat du sondage de la clef, qui ne doit pas avoir été trouvée
+     * @param hash Le hash primaire de la clef
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur de la paire clef-valeur
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_placer(
+            const ResultatSondage &resultat, size_t hash, const TypeClef &clef, const TypeElement &element) {
+        if (m_controle[resultat.index] == EFFACE) --m_nEffaces;
+        m_controle[resultat.index] = _fragment(hash);
+        m_clefs[resultat.index] = clef;
+        m_elements[resultat.index] = element;
+        ++m_cardinalite;
+        _statistiques(resultat.collisions);
+    }
+
+    /**
+     * @brief Reconstruit la table avec un nombre de groupes donné. Les positions effacées disparaissent.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param nGroupes Le nouveau nombre de groupes, une capacité valide selon PolitiqueCapacite
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_reconstruire(
+            size_t nGroupes) {
+        std::vector<uint8_t> ancienControle;
+        std::vector<TypeClef> anciennesClefs;
+        std::vector<TypeElement> anciensElements;
+        ancienControle.swap(m_controle);
+        anciennesClefs.swap(m_clefs);
+        anciensElements.swap(m_elements);
+        m_nGroupes = nGroupes;
+        m_controle.assign(m_nGroupes * GroupeControle::LARGEUR, VACANT);
+        m_clefs.resize(m_controle.size());
+        m_elements.resize(m_controle.size());
+        m_hachage = FoncteurHachage(m_nGroupes);
+        m_cardinalite = 0;
+        m_nEffaces = 0;
+        for (size_t i = 0; i < ancienControle.size(); ++i) {
+            if (ancienControle[i] & VACANT) continue;
+            size_t hash = m_hachage.primaire(anciennesClefs[i]);
+            _placer(_sonder(anciennesClefs[i], hash), hash, anciennesClefs[i], anciensElements[i]);
+        }
+    }
+
+    /**
+     * @brief Indique si les positions occupées ou effacées dépassent TAUX_MAX_POUR_MILLE de la capacité
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return true si la table doit être reconstruite
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    bool TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_doitEtreRehachee() const {
+        return 1000 * (m_cardinalite + m_nEffaces) > TAUX_MAX_POUR_MILLE * capacite();
+    }
+
+    /**
+     * @brief À chaque appel de _placer, incrément le nombre d'insertions de 1 et le nombre de collisions
+     * du nombre spécifié.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param collisions Le nombre de groupes pleins rencontrés lors de la tentative de trouver un index libre
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageGroupes<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_statistiques(
+            const size_t &collisions) {
+        m_nCollisions += collisions;
+        ++m_nInsertions;
+    }
+
+} //Fin du namespace
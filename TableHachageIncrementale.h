@@ -0,0 +1,101 @@
+/**
+ * \file TableHachageIncrementale.h
+ * \brief Classe définissant une table de hachage à rehachage incrémental.
+ * \version 0.4
+ * \date octobre 2026
+ *
+ *	Résolution des collisions par redistribution quadratique, comme TableHachage. L'agrandissement de la table est
+ *	étalé sur les opérations qui le suivent au lieu d'être fait d'un seul coup.
+ *
+ */
+
+#ifndef TABLEHACHAGEINCREMENTALE_H_
+#define TABLEHACHAGEINCREMENTALE_H_
+
+#include <ostream>
+#include "TableHachage.h"
+
+namespace labTableHachage {
+
+/**
+ * \class TableHachageIncrementale
+ *
+ * \brief classe générique représentant une table de dispersion en adressage ouvert à rehachage incrémental
+ *
+ *  Lorsque l'insertion suivante dépasserait TAUX_MAX, la table actuelle devient l'ancienne table et une nouvelle
+ *  table de la capacité suivante est créée. Les deux tables coexistent pendant la migration: chaque insertion ou
+ *  retrait déplace d'abord au plus ENTREES_PAR_OPERATION positions de l'ancienne table vers la nouvelle, et les
+ *  recherches consultent les deux tables. Aucune opération ne parcourt donc toute la table, sauf l'allocation de la
+ *  nouvelle table au début de la migration.
+ *
+ *  L'ancienne table, de capacité c, contient au plus c / 2 entrées et sa migration dure au plus
+ *  c / ENTREES_PAR_OPERATION opérations. La nouvelle table, de capacité environ 2c, contient donc au plus 3c / 4
+ *  entrées à la fin de la migration: elle n'atteint pas elle-même TAUX_MAX pendant la migration.
+ *
+ * TypeClef : le type des clefs
+ * TypeElement : le type des éléments
+ * FoncteurHachage: foncteur de hachage, comme pour TableHachage. Voir FoncteurHachage.hpp
+ * PolitiqueCapacite: choix des capacités de la table, celle du foncteur de hachage comme pour TableHachage. Voir
+ * PolitiquesCapacite.h
+ */
+
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage,
+            class PolitiqueCapacite = typename CapaciteHacheur<FoncteurHachage>::type>
+    class TableHachageIncrementale {
+        static_assert(CapaciteCompatible<FoncteurHachage, PolitiqueCapacite>::value,
+                      "PolitiqueCapacite doit être celle du foncteur de hachage");
+    public:
+
+        TableHachageIncrementale(size_t = 100);
+
+        void inserer(const TypeClef &, const TypeElement &);
+
+        void enlever(const TypeClef &);
+
+        bool contient(const TypeClef &) const;
+
+        TypeElement element(const TypeClef &) const;
+
+        TypeElement *trouver(const TypeClef &);
+
+        const TypeElement *trouver(const TypeClef &) const;
+
+        void vider();
+
+        int taille() const;
+
+        size_t capacite() const;
+
+        bool migrationEnCours() const;
+
+        void afficher(std::ostream &) const;
+
+        template<typename TClef, typename TElement, class FHachage, class PCapacite>
+        friend std::ostream &operator<<(std::ostream &,
+                                        const TableHachageIncrementale<TClef, TElement, FHachage, PCapacite> &);
+
+    private:
+
+        typedef TableHachage<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite> Table;
+
+        // Attributs
+
+        static const size_t ENTREES_PAR_OPERATION = 4; /*!< Nombre de positions migrées par insertion ou retrait */
+        Table m_table; /*!< La table courante, qui reçoit toutes les insertions */
+        Table m_ancienne; /*!< La table en cours de migration, inutilisée hors migration */
+        size_t m_curseur; /*!< La prochaine position de m_ancienne à migrer */
+        bool m_migration; /*!< true si une migration est en cours */
+
+        // Méthodes privées
+
+        bool _doitCommencerMigration() const;
+
+        void _commencerMigration();
+
+        void _migrer(size_t);
+    };
+} //Fin du namespace
+
+#include "TableHachageIncrementale.hpp"
+
+#endif
@@ -0,0 +1,282 @@
+#include "ContratException.h"
+#include <algorithm>
+#include <utility>
+
+namespace labTableHachage {
+
+    /**
+     * @brief Constructeur
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param n La cardinalité approximative de la table courante, arrondie à la capacité valide suivante selon
+     * PolitiqueCapacite.
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::TableHachageIncrementale(
+            size_t n) :
+            m_table(n),
+            m_ancienne(1),
+            m_curseur(0),
+            m_migration(false) {}
+
+    /**
+     * @brief Ajoute une paire clef-valeur dans la table courante, après avoir avancé la migration en cours ou en
+     * avoir commencé une au besoin
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur de la paire clef-valeur
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::inserer(
+            const TypeClef &clef, const TypeElement &element) {
+        _migrer(ENTREES_PAR_OPERATION);
+        if (_doitCommencerMigration()) _commencerMigration();
+        PRECONDITION(!m_migration || !m_ancienne.contient(clef));
+        m_table.inserer(clef, element);
+    }
+
+    /**
+     * @brief Retirer une paire clef-valeur de la table qui la contient, après avoir avancé la migration en cours
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clé de la paire clef-valeur à retirer
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::enlever(
+            const TypeClef &clef) {
+        _migrer(ENTREES_PAR_OPERATION);
+        if (m_migration && m_ancienne.contient(clef)) m_ancienne.enlever(clef);
+        else m_table.enlever(clef);
+    }
+
+    /**
+     * @brief Vérifie la présence d'une paire clef-valeur dans la table courante, puis dans l'ancienne table pendant
+     * une migration
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef la clef de la paire clef-valeur cherchée
+     * @return true si la clef est présente dans la table
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    bool TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::contient(
+            const TypeClef &clef) const {
+        return trouver(clef) != nullptr;
+    }
+
+    /**
+     * @brief Retourne la valeur correspondant à une clef donnée
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return La valeur correspondant à la clef
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    TypeElement TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::element(
+            const TypeClef &clef) const {
+        const TypeElement *element = trouver(clef);
+        PRECONDITION(element != nullptr);
+        return *element;
+    }
+
+    /**
+     * @brief Cherche la valeur correspondant à une clef dans la table courante, puis dans l'ancienne table pendant
+     * une migration
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente. Le pointeur est invalidé par
+     * la prochaine insertion ou le prochain retrait, qui peuvent migrer l'entrée.
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    TypeElement *TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::trouver(
+            const TypeClef &clef) {
+        TypeElement *element = m_table.trouver(clef);
+        if (element == nullptr && m_migration) element = m_ancienne.trouver(clef);
+        return element;
+    }
+
+    /**
+     * @brief Version constante de trouver
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    const TypeElement *TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::trouver(
+            const TypeClef &clef) const {
+        const TypeElement *element = m_table.trouver(clef);
+        if (element == nullptr && m_migration) element = m_ancienne.trouver(clef);
+        return element;
+    }
+
+    /**
+     * @brief Enlève tous les éléments de la table et abandonne la migration en cours
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::vider() {
+        m_table.vider();
+        m_ancienne = Table(1);
+        m_curseur = 0;
+        m_migration = false;
+    }
+
+    /**
+     * @brief Donne le nombre d'éléments dans la table, en comptant ceux qui n'ont pas encore été migrés
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return Le nombre d'éléments de la table de dispersion
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    int TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::taille() const {
+        return m_migration ? m_table.taille() + m_ancienne.taille() : m_table.taille();
+    }
+
+    /**
+     * @brief Donne la capacité de la table courante
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return Le nombre de positions de la table courante
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    size_t TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::capacite() const {
+        return m_table.capacite();
+    }
+
+    /**
+     * @brief Indique si une migration de l'ancienne table vers la table courante est en cours
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return true si les recherches consultent encore l'ancienne table
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    bool TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::migrationEnCours() const {
+        return m_migration;
+    }
+
+    /**
+     * @brief Insère la liste des paires clé-valeur des deux tables dans un flux de sortie
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param p_out Le flux de sortie
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::afficher(
+            std::ostream &p_out) const {
+        p_out << "{";
+        for (size_t i = 0; i < m_table.m_tab.size(); ++i) {
+            if (m_table._estOccupee(i)) p_out << m_table.m_tab[i] << ",";
+        }
+        for (size_t i = 0; m_migration && i < m_ancienne.m_tab.size(); ++i) {
+            if (m_ancienne._estOccupee(i)) p_out << m_ancienne.m_tab[i] << ",";
+        }
+        p_out << "}";
+    }
+
+    /**
+     * @brief Opérateur d'insertion dans un flux de sortie
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param p_out
+     * @param p_source
+     * @return
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    std::ostream &operator<<(std::ostream &p_out,
+                             const TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage,
+                                     PolitiqueCapacite> &p_source) {
+        p_source.afficher(p_out);
+        return p_out;
+    }
+
+    /**
+     * @brief Indique si l'ajout d'une entrée porterait le taux d'occupation de la table courante au-delà de TAUX_MAX
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return true si une migration doit commencer avant l'ajout
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    bool TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_doitCommencerMigration()
+    const {
+        return m_table._doitEtreRehachee();
+    }
+
+    /**
+     * @brief La table courante devient l'ancienne table et est remplacée par une table vide de la capacité suivante.
+     * Une migration précédente qui ne serait pas terminée l'est d'abord.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_commencerMigration() {
+        if (m_migration) _migrer(m_ancienne.capacite());
+        m_ancienne = std::move(m_table);
+        m_table = Table(PolitiqueCapacite::agrandir(m_ancienne.capacite()));
+        m_curseur = 0;
+        m_migration = true;
+    }
+
+    /**
+     * @brief Déplace les entrées occupées d'au plus n positions de l'ancienne table vers la table courante. Chaque
+     * entrée migrée devient effacée dans l'ancienne table, pour que les séquences de sondage des entrées restantes
+     * demeurent intactes. L'ancienne table est libérée à la fin de la migration.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param n Le nombre maximal de positions de l'ancienne table à parcourir
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageIncrementale<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_migrer(size_t n) {
+        if (!m_migration) return;
+        size_t fin = std::min(m_curseur + n, m_ancienne.capacite());
+        for (; m_curseur < fin; ++m_curseur) {
+            if (!m_ancienne._estOccupee(m_curseur)) continue;
+            typename Table::EntreeHachage &entree = m_ancienne.m_tab[m_curseur];
+            size_t hash = m_table._hashEntree(entree);
+            m_table._placer(m_table._sonderPositionLibre(entree.m_clef, hash), std::move(entree.m_clef),
+                            std::move(entree.m_el));
+            entree.m_info = Table::EFFACE;
+            --m_ancienne.m_cardinalite;
+            ++m_ancienne.m_nEffaces;
+        }
+        if (m_curseur == m_ancienne.capacite()) {
+            m_ancienne = Table(1);
+            m_migration = false;
+        }
+    }
+
+} //Fin du namespace
@@ -0,0 +1,233 @@
+/**
+ * \file TableHachageLectureOptimiste.h
+ * \brief Classe définissant une table de hachage à lectures sans verrou, pour des tables surtout lues.
+ * \version 0.4
+ * \date octobre 2026
+ *
+ *	Résolution des collisions par redistribution quadratique, comme TableHachage. Les lectures ne prennent aucun
+ *	verrou: chaque entrée est protégée par un numéro de version (seqlock), et le tableau des entrées est remplacé
+ *	d'un seul coup lors d'un rehachage, l'ancien n'étant libéré qu'une fois qu'aucune lecture ne peut plus l'utiliser.
+ *
+ */
+
+#ifndef TABLEHACHAGELECTUREOPTIMISTE_H_
+#define TABLEHACHAGELECTUREOPTIMISTE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "OutilsHachage.h"
+#include "PolitiquesCapacite.h"
+
+namespace labTableHachage {
+
+/**
+ * \class IndiceFil
+ *
+ * \brief Attribue à chaque fil d'exécution vivant un indice distinct inférieur à MAX_FILS, libéré à la fin du fil
+ */
+    class IndiceFil {
+    public:
+        static const size_t MAX_FILS = 256; /*!< Nombre maximal de fils qui utilisent des indices en même temps */
+
+        static size_t courant();
+
+    private:
+        IndiceFil();
+
+        ~IndiceFil();
+
+        size_t m_indice; /*!< l'indice réservé par le fil */
+        static inline std::atomic<bool> s_reserves[MAX_FILS] = {}; /*!< true pour chaque indice réservé */
+    };
+
+/**
+ * \class TableHachageLectureOptimiste
+ *
+ * \brief classe générique représentant une table de dispersion en adressage ouvert dont les lectures ne prennent
+ * aucun verrou et n'écrivent dans aucune donnée partagée
+ *
+ *  Les modifications sont sérialisées par un verrou. Chaque entrée porte un numéro de version, impair pendant qu'une
+ *  modification l'écrit: une lecture relit l'entrée tant que la version a changé pendant sa lecture. Les entrées ne
+ *  sont jamais déplacées à l'intérieur d'un tableau; le rehachage, tout comme l'élimination des entrées effacées,
+ *  construit un nouveau tableau et le publie par un seul échange de pointeur.
+ *
+ *  Un tableau remplacé est retiré avec l'époque de son remplacement et libéré seulement lorsque chaque fil qui lit
+ *  est inactif ou a commencé sa lecture à une époque ultérieure. Chaque fil annonce l'époque de sa lecture dans sa
+ *  propre case, sur sa propre ligne de cache: une lecture n'écrit donc que dans une ligne que les autres fils ne
+ *  modifient pas.
+ *
+ *  Les clefs et les valeurs sont lues pendant qu'une modification peut les écrire: elles sont donc rangées dans des
+ *  std::atomic, et leurs types doivent être copiables trivialement et atomiques sans verrou (entiers, pointeurs,
+ *  double...).
+ *
+ * TypeClef : le type des clefs
+ * TypeElement : le type des éléments
+ * FoncteurHachage: foncteur de hachage, comme pour TableHachage. Voir FoncteurHachage.hpp
+ * PolitiqueCapacite: choix des capacités de la table, comme pour TableHachage. Voir PolitiquesCapacite.h
+ */
+
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite = CapacitePremiere>
+    class TableHachageLectureOptimiste {
+    public:
+
+        TableHachageLectureOptimiste(size_t = 100);
+
+        ~TableHachageLectureOptimiste();
+
+        TableHachageLectureOptimiste(const TableHachageLectureOptimiste &) = delete;
+
+        TableHachageLectureOptimiste &operator=(const TableHachageLectureOptimiste &) = delete;
+
+        void inserer(const TypeClef &, const TypeElement &);
+
+        bool insererOuAssigner(const TypeClef &, const TypeElement &);
+
+        void enlever(const TypeClef &);
+
+        bool contient(const TypeClef &) const;
+
+        TypeElement element(const TypeClef &) const;
+
+        bool lire(const TypeClef &, TypeElement &) const;
+
+        void rehacher();
+
+        void vider();
+
+        int taille() const;
+
+        size_t capacite() const;
+
+        size_t nombreTableauxRetires() const;
+
+    private:
+
+        static_assert(std::is_trivially_copyable<TypeClef>::value && std::atomic<TypeClef>::is_always_lock_free,
+                      "TypeClef doit être copiable trivialement et atomique sans verrou");
+        static_assert(std::is_trivially_copyable<TypeElement>::value && std::atomic<TypeElement>::is_always_lock_free,
+                      "TypeElement doit être copiable trivialement et atomique sans verrou");
+
+        /**
+         * \enum EtatEntree
+         * \brief Les tags pour définir l'état d'une entrée dans la table
+         */
+        enum EtatEntree : uint8_t {
+            OCCUPE, /*!< l'entrée est occupée*/
+            VACANT, /*!< l'entrée n'a jamais été utilisé*/
+            EFFACE /*!< l'entrée a été utilisée mais ne l'est plus actuellement*/
+        };
+
+        /**
+         * \class EntreeHachage
+         *
+         * \brief Une entrée de la table, lisible pendant qu'une modification l'écrit
+         */
+        class EntreeHachage {
+        public:
+            std::atomic<uint32_t> m_version; /*!< impair pendant une écriture de l'entrée */
+            std::atomic<EtatEntree> m_info; /*!< tag pour préciser l'état de l'entrée */
+            std::atomic<TypeClef> m_clef; /*!< la clé de hachage*/
+            std::atomic<TypeElement> m_el; /*!< la valeur associée à la clé*/
+
+            EntreeHachage() :
+                    m_version(0), m_info(VACANT), m_clef(TypeClef()), m_el(TypeElement()) {
+            }
+        };
+
+        /**
+         * \struct Instantane
+         *
+         * \brief Une copie cohérente d'une entrée, lue entre deux versions paires identiques
+         */
+        struct Instantane {
+            EtatEntree info;
+            TypeClef clef;
+            TypeElement el;
+        };
+
+        /**
+         * \class Tableau
+         *
+         * \brief Un tableau d'entrées et le foncteur de hachage de sa capacité, publiés ensemble
+         */
+        class Tableau {
+        public:
+            size_t m_tailleTable;
+            FoncteurHachage m_hachage; /*!< Foncteur de hachage de la capacité du tableau */
+            std::unique_ptr<EntreeHachage[]> m_entrees;
+
+            Tableau(size_t p_tailleTable) :
+                    m_tailleTable(p_tailleTable), m_hachage(p_tailleTable),
+                    m_entrees(new EntreeHachage[p_tailleTable]) {
+            }
+        };
+
+        /**
+         * \struct CaseLecteur
+         *
+         * \brief L'époque de la lecture en cours d'un fil, ou 0 s'il ne lit pas, seule sur sa ligne de cache
+         */
+        struct alignas(64) CaseLecteur {
+            std::atomic<uint64_t> m_epoque{0};
+        };
+
+        /**
+         * \class GardeLecture
+         *
+         * \brief Annonce une lecture dans la case du fil courant pendant sa durée de vie
+         */
+        class GardeLecture {
+        public:
+            GardeLecture(const TableHachageLectureOptimiste &p_table) :
+                    m_case(p_table.m_lecteurs[IndiceFil::courant()]) {
+                m_case.m_epoque.store(p_table.m_epoque.load());
+            }
+
+            ~GardeLecture() {
+                m_case.m_epoque.store(0, std::memory_order_release);
+            }
+
+        private:
+            CaseLecteur &m_case;
+        };
+
+        // Attributs
+
+        std::atomic<Tableau *> m_tableau; /*!< Le tableau publié, lu par les lectures */
+        std::atomic<uint64_t> m_epoque; /*!< Augmente à chaque publication d'un tableau */
+        std::unique_ptr<CaseLecteur[]> m_lecteurs; /*!< Une case par indice de fil */
+        mutable std::mutex m_ecriture; /*!< Sérialise les modifications */
+        std::vector<std::pair<uint64_t, Tableau *> > m_retires; /*!< Les tableaux remplacés et leur époque */
+        std::atomic<size_t> m_cardinalite; /*!< Le nombre d'éléments actifs dans la table */
+        size_t m_nEffaces; /*!< Le nombre d'entrées effacées dans le tableau publié */
+        static const int TAUX_MAX = 50; /*!< Taux de remplissage maximum dans la table */
+        static const int TAUX_MAX_UTILISEES = 75; /*!< Taux maximum d'entrées occupées ou effacées dans la table */
+
+        // Méthodes privées
+
+        static Instantane _lire(const EntreeHachage &);
+
+        static void _ecrire(EntreeHachage &, EtatEntree, const TypeClef &, const TypeElement &);
+
+        bool _chercher(const TypeClef &, TypeElement &) const;
+
+        size_t _sonder(const Tableau &, const TypeClef &, bool &) const;
+
+        void _placer(size_t, const TypeClef &, const TypeElement &);
+
+        Tableau *_copier(size_t) const;
+
+        void _remplacer(Tableau *);
+
+        void _recuperer();
+    };
+} //Fin du namespace
+
+#include "TableHachageLectureOptimiste.hpp"
+
+#endif
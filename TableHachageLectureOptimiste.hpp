@@ -0,0 +1,476 @@
+#include "ContratException.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace labTableHachage {
+
+    /**
+     * @brief Donne l'indice du fil courant, réservé lors de son premier appel dans ce fil
+     * @return Un indice inférieur à MAX_FILS, qu'aucun autre fil vivant n'utilise
+     * @except AssertionException si MAX_FILS fils utilisent déjà un indice
+     */
+    inline size_t IndiceFil::courant() {
+        thread_local IndiceFil indice;
+        return indice.m_indice;
+    }
+
+    /**
+     * @brief Constructeur, réserve le premier indice libre
+     */
+    inline IndiceFil::IndiceFil() : m_indice(0) {
+        bool reserve = false;
+        while (!s_reserves[m_indice].compare_exchange_strong(reserve, true)) {
+            reserve = false;
+            ++m_indice;
+            ASSERTION(m_indice < MAX_FILS);
+        }
+    }
+
+    /**
+     * @brief Destructeur, appelé à la fin du fil, libère l'indice pour un autre fil
+     */
+    inline IndiceFil::~IndiceFil() {
+        s_reserves[m_indice].store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Constructeur
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param n La capacité approximative de la table
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::
+    TableHachageLectureOptimiste(size_t n) :
+            m_tableau(new Tableau(PolitiqueCapacite::capacite(n))),
+            m_epoque(1),
+            m_lecteurs(new CaseLecteur[IndiceFil::MAX_FILS]),
+            m_cardinalite(0),
+            m_nEffaces(0) {}
+
+    /**
+     * @brief Destructeur. Aucune lecture ne doit être en cours.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::
+    ~TableHachageLectureOptimiste() {
+        delete m_tableau.load();
+        for (auto &retire: m_retires) delete retire.second;
+    }
+
+    /**
+     * @brief Ajoute une paire clef-valeur dans la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur de la paire clef-valeur
+     * @except PreconditionException si la clef est déjà présente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::inserer(
+            const TypeClef &clef, const TypeElement &element) {
+        std::lock_guard<std::mutex> verrou(m_ecriture);
+        bool trouvee;
+        size_t index = _sonder(*m_tableau.load(std::memory_order_relaxed), clef, trouvee);
+        PRECONDITION(!trouvee);
+        _placer(index, clef, element);
+    }
+
+    /**
+     * @brief Insère la paire clef-valeur si la clef est absente, sinon remplace la valeur associée à la clef
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur à associer à la clef
+     * @return true si la paire a été insérée, false si une valeur existante a été remplacée
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    bool TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::insererOuAssigner(
+            const TypeClef &clef, const TypeElement &element) {
+        std::lock_guard<std::mutex> verrou(m_ecriture);
+        Tableau &tableau = *m_tableau.load(std::memory_order_relaxed);
+        bool trouvee;
+        size_t index = _sonder(tableau, clef, trouvee);
+        if (trouvee) {
+            _ecrire(tableau.m_entrees[index], OCCUPE, clef, element);
+            return false;
+        }
+        _placer(index, clef, element);
+        return true;
+    }
+
+    /**
+     * @brief Retirer une paire clef-valeur de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clé de la paire clef-valeur à retirer
+     * @except PreconditionException si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::enlever(
+            const TypeClef &clef) {
+        std::lock_guard<std::mutex> verrou(m_ecriture);
+        Tableau &tableau = *m_tableau.load(std::memory_order_relaxed);
+        bool trouvee;
+        size_t index = _sonder(tableau, clef, trouvee);
+        PRECONDITION(trouvee);
+        EntreeHachage &entree = tableau.m_entrees[index];
+        _ecrire(entree, EFFACE, clef, entree.m_el.load(std::memory_order_relaxed));
+        m_cardinalite.store(m_cardinalite.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        ++m_nEffaces;
+    }
+
+    /**
+     * @brief Vérifie la présence d'une paire clef-valeur dans la table, sans verrou
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef la clef de la paire clef-valeur cherchée
+     * @return true si la clef est présente dans la table
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    bool TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::contient(
+            const TypeClef &clef) const {
+        TypeElement element;
+        return _chercher(clef, element);
+    }
+
+    /**
+     * @brief Retourne une copie de la valeur correspondant à une clef donnée, sans verrou
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return La valeur correspondant à la clef au moment de la recherche
+     * @except PreconditionException si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    TypeElement TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::element(
+            const TypeClef &clef) const {
+        TypeElement element = TypeElement();
+        bool trouvee = _chercher(clef, element);
+        PRECONDITION(trouvee);
+        return element;
+    }
+
+    /**
+     * @brief Copie la valeur correspondant à une clef si elle est présente, en une seule recherche sans verrou
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @param element Reçoit la valeur correspondant à la clef, si elle est présente
+     * @return true si la clef est présente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    bool TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::lire(
+            const TypeClef &clef, TypeElement &element) const {
+        return _chercher(clef, element);
+    }
+
+    /**
+     * @brief Agrandit la table à la capacité suivante selon PolitiqueCapacite. Le nouveau tableau est publié d'un seul
+     * coup; les lectures en cours terminent dans l'ancien.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::rehacher() {
+        std::lock_guard<std::mutex> verrou(m_ecriture);
+        _remplacer(_copier(PolitiqueCapacite::agrandir(m_tableau.load(std::memory_order_relaxed)->m_tailleTable)));
+    }
+
+    /**
+     * @brief Enlève tous les éléments de la table en publiant un tableau vide de même capacité
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::vider() {
+        std::lock_guard<std::mutex> verrou(m_ecriture);
+        _remplacer(new Tableau(m_tableau.load(std::memory_order_relaxed)->m_tailleTable));
+        m_cardinalite.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Donne le nombre d'éléments dans la table, tel que laissé par la dernière modification terminée
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return Le nombre d'éléments de la table de dispersion
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    int TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::taille() const {
+        return static_cast<int>(m_cardinalite.load(std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Donne le nombre de positions du tableau publié
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return La capacité actuelle de la table de dispersion
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    size_t TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::capacite() const {
+        GardeLecture garde(*this);
+        return m_tableau.load()->m_tailleTable;
+    }
+
+    /**
+     * @brief Donne le nombre de tableaux remplacés qui ne sont pas encore libérés parce qu'une lecture pouvait encore
+     * les utiliser lors de la dernière modification
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @return Le nombre de tableaux retirés en attente de libération
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    size_t TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::
+    nombreTableauxRetires() const {
+        std::lock_guard<std::mutex> verrou(m_ecriture);
+        return m_retires.size();
+    }
+
+    /**
+     * @brief Lit une copie cohérente d'une entrée, en recommençant tant qu'une écriture la modifiait pendant la
+     * lecture. La lecture n'écrit rien: elle compare seulement la version avant et après la copie. Les champs sont
+     * écrits avec memory_order_release et lus avec memory_order_acquire plutôt qu'entourés de barrières: une lecture
+     * qui voit un champ nouvellement écrit voit donc aussi la version impaire qui le précède, et ThreadSanitizer, qui
+     * ne comprend pas les barrières, peut vérifier le protocole.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param entree L'entrée à lire
+     * @return Une copie de l'état, de la clef et de la valeur de l'entrée à un même instant
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    typename TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::Instantane
+    TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_lire(
+            const EntreeHachage &entree) {
+        Instantane copie;
+        uint32_t avant, apres;
+        do {
+            avant = entree.m_version.load(std::memory_order_acquire);
+            copie.info = entree.m_info.load(std::memory_order_acquire);
+            copie.clef = entree.m_clef.load(std::memory_order_acquire);
+            copie.el = entree.m_el.load(std::memory_order_acquire);
+            apres = entree.m_version.load(std::memory_order_relaxed);
+        } while ((avant & 1) != 0 || avant != apres);
+        return copie;
+    }
+
+    /**
+     * @brief Écrit une entrée du tableau publié entre deux incréments de sa version. Appelée seulement sous le verrou
+     * des modifications. Voir _lire.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param entree L'entrée à écrire
+     * @param info Le nouvel état de l'entrée
+     * @param clef La nouvelle clef de l'entrée
+     * @param element La nouvelle valeur de l'entrée
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_ecrire(
+            EntreeHachage &entree, EtatEntree info, const TypeClef &clef, const TypeElement &element) {
+        uint32_t version = entree.m_version.load(std::memory_order_relaxed);
+        entree.m_version.store(version + 1, std::memory_order_relaxed);
+        entree.m_info.store(info, std::memory_order_release);
+        entree.m_clef.store(clef, std::memory_order_release);
+        entree.m_el.store(element, std::memory_order_release);
+        entree.m_version.store(version + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Cherche une clef dans le tableau publié sans verrou. La lecture est annoncée dans la case du fil courant
+     * pour que le tableau ne soit pas libéré avant la fin de la recherche.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param clef La clef cherchée
+     * @param element Reçoit la valeur correspondant à la clef, si elle est présente
+     * @return true si la clef est présente
+     * @except AssertionError si un nombre excessif de collisions est rencontré
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    bool TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_chercher(
+            const TypeClef &clef, TypeElement &element) const {
+        GardeLecture garde(*this);
+        const Tableau *tableau = m_tableau.load();
+        for (size_t tentative = 0; tentative < MAX_TENTATIVES; ++tentative) {
+            Instantane copie = _lire(tableau->m_entrees[tableau->m_hachage(clef, tentative)]);
+            if (copie.info == VACANT) return false;
+            if (copie.info == OCCUPE && copie.clef == clef) {
+                element = copie.el;
+                return true;
+            }
+        }
+        ASSERTION(false);
+        return false;
+    }
+
+    /**
+     * @brief Parcourt la séquence de sondage d'une clef dans un tableau. Appelée seulement sous le verrou des
+     * modifications, ou sur un tableau pas encore publié.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param tableau Le tableau à sonder
+     * @param clef La clef cherchée
+     * @param trouvee Reçoit true si la clef est présente
+     * @return La position de la clef si elle est présente, sinon la première position libre de sa séquence
+     * @except AssertionError si un nombre excessif de collisions est rencontré
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    size_t TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_sonder(
+            const Tableau &tableau, const TypeClef &clef, bool &trouvee) const {
+        size_t libre = tableau.m_tailleTable;
+        trouvee = false;
+        for (size_t tentative = 0;; ++tentative) {
+            ASSERTION(tentative < MAX_TENTATIVES);
+            size_t index = tableau.m_hachage(clef, tentative);
+            const EntreeHachage &entree = tableau.m_entrees[index];
+            EtatEntree info = entree.m_info.load(std::memory_order_relaxed);
+            if (info == VACANT) return libre != tableau.m_tailleTable ? libre : index;
+            if (info == EFFACE) {
+                if (libre == tableau.m_tailleTable) libre = index;
+            } else if (entree.m_clef.load(std::memory_order_relaxed) == clef) {
+                trouvee = true;
+                return index;
+            }
+        }
+    }
+
+    /**
+     * @brief Place une clef absente à la position trouvée par _sonder. Si la table doit d'abord être agrandie ou
+     * débarrassée de ses entrées effacées, un nouveau tableau est publié et la clef y est placée.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param index La position libre trouvée par _sonder dans le tableau publié
+     * @param clef La clef, absente de la table
+     * @param element La valeur associée à la clef
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_placer(
+            size_t index, const TypeClef &clef, const TypeElement &element) {
+        Tableau *tableau = m_tableau.load(std::memory_order_relaxed);
+        size_t cardinalite = m_cardinalite.load(std::memory_order_relaxed);
+        bool effacee = tableau->m_entrees[index].m_info.load(std::memory_order_relaxed) == EFFACE;
+        bool rehacher = 100 * (cardinalite + 1) > TAUX_MAX * tableau->m_tailleTable;
+        if (rehacher || 100 * (cardinalite + m_nEffaces + (effacee ? 0 : 1)) >
+                        TAUX_MAX_UTILISEES * tableau->m_tailleTable) {
+            tableau = _copier(rehacher ? PolitiqueCapacite::agrandir(tableau->m_tailleTable) : tableau->m_tailleTable);
+            _remplacer(tableau);
+            bool trouvee;
+            index = _sonder(*tableau, clef, trouvee);
+            effacee = false;
+        }
+        if (effacee) --m_nEffaces;
+        _ecrire(tableau->m_entrees[index], OCCUPE, clef, element);
+        m_cardinalite.store(cardinalite + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Construit un nouveau tableau contenant les entrées occupées du tableau publié. Le nouveau tableau n'est
+     * visible d'aucune lecture avant d'être publié par _remplacer.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param nouvelleTaille La capacité du nouveau tableau
+     * @return Le nouveau tableau, sans entrée effacée
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    typename TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::Tableau *
+    TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_copier(
+            size_t nouvelleTaille) const {
+        const Tableau &ancien = *m_tableau.load(std::memory_order_relaxed);
+        Tableau *nouveau = new Tableau(nouvelleTaille);
+        for (size_t i = 0; i < ancien.m_tailleTable; ++i) {
+            const EntreeHachage &entree = ancien.m_entrees[i];
+            if (entree.m_info.load(std::memory_order_relaxed) != OCCUPE) continue;
+            TypeClef clef = entree.m_clef.load(std::memory_order_relaxed);
+            bool trouvee;
+            EntreeHachage &destination = nouveau->m_entrees[_sonder(*nouveau, clef, trouvee)];
+            destination.m_info.store(OCCUPE, std::memory_order_relaxed);
+            destination.m_clef.store(clef, std::memory_order_relaxed);
+            destination.m_el.store(entree.m_el.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        return nouveau;
+    }
+
+    /**
+     * @brief Publie un nouveau tableau et retire l'ancien avec la nouvelle époque, puis libère les tableaux retirés
+     * qu'aucune lecture ne peut plus utiliser
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @param nouveau Le tableau à publier, construit par _copier ou vide
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_remplacer(
+            Tableau *nouveau) {
+        Tableau *ancien = m_tableau.load(std::memory_order_relaxed);
+        m_tableau.store(nouveau);
+        m_nEffaces = 0;
+        m_retires.emplace_back(m_epoque.fetch_add(1) + 1, ancien);
+        _recuperer();
+    }
+
+    /**
+     * @brief Libère les tableaux retirés à une époque où chaque fil était inactif ou lisait déjà depuis une époque au
+     * moins aussi récente. Une lecture annoncée à cette époque a chargé le pointeur après sa publication, et une
+     * lecture inactive lors du parcours des cases le chargera aussi après.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage, class PolitiqueCapacite>
+    void TableHachageLectureOptimiste<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite>::_recuperer() {
+        uint64_t plusAncienne = UINT64_MAX;
+        for (size_t i = 0; i < IndiceFil::MAX_FILS; ++i) {
+            uint64_t epoque = m_lecteurs[i].m_epoque.load();
+            if (epoque != 0) plusAncienne = std::min(plusAncienne, epoque);
+        }
+        auto fin = std::remove_if(m_retires.begin(), m_retires.end(),
+                                  [plusAncienne](const std::pair<uint64_t, Tableau *> &retire) {
+                                      if (retire.first > plusAncienne) return false;
+                                      delete retire.second;
+                                      return true;
+                                  });
+        m_retires.erase(fin, m_retires.end());
+    }
+
+} //Fin du namespace
@@ -0,0 +1,138 @@
+/**
+ * \file TableHachageLineaire.h
+ * \brief Classe définissant une table de hachage à sondage linéaire sans entrées effacées.
+ * \version 0.4
+ * \date octobre 2026
+ *
+ *	Résolution des collisions par redistribution linéaire. Le retrait d'une entrée recule les entrées suivantes de
+ *	sa grappe (backward-shift), de sorte que la table ne contient jamais d'entrées effacées.
+ *
+ */
+
+#ifndef TABLEHACHAGELINEAIRE_H_
+#define TABLEHACHAGELINEAIRE_H_
+
+#include <ostream>
+#include <vector>
+#include "OutilsHachage.h"
+
+namespace labTableHachage {
+
+/**
+ * \class TableHachageLineaire
+ *
+ * \brief classe générique représentant une table de dispersion en adressage ouvert à sondage linéaire
+ *
+ *  La position de départ d'une clef est H(clef, 0), calculée par le foncteur de hachage; les positions suivantes
+ *  sont consécutives. Comme aucune entrée effacée ne subsiste, la longueur des séquences de sondage ne dépend que
+ *  du taux de remplissage, même après un très grand nombre d'insertions et de retraits.
+ *
+ * TypeClef : le type des clefs
+ * TypeElement : le type des éléments
+ * FoncteurHachage: foncteur de hachage. Seule la position de départ H(clef, 0) est utilisée. Voir
+ * FoncteurHachage.hpp
+ */
+
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    class TableHachageLineaire {
+    public:
+
+        TableHachageLineaire(size_t = 100);
+
+        void inserer(const TypeClef &, const TypeElement &);
+
+        void enlever(const TypeClef &);
+
+        bool contient(const TypeClef &) const;
+
+        TypeElement element(const TypeClef &) const;
+
+        TypeElement *trouver(const TypeClef &);
+
+        const TypeElement *trouver(const TypeClef &) const;
+
+        void rehacher();
+
+        void vider();
+
+        int taille() const;
+
+        double statistiques() const;
+
+        double longueurSondageMoyenne() const;
+
+        void afficher(std::ostream &) const;
+
+        template<typename TClef, typename TElement, class FHachage>
+        friend std::ostream &operator<<(std::ostream &,
+                                        const TableHachageLineaire<TClef, TElement, FHachage> &);
+
+    private:
+
+        /**
+         * \enum EtatEntree
+         * \brief Les tags pour définir l'état d'une entrée dans la table
+         */
+        enum EtatEntree {
+            OCCUPE, /*!< l'entrée est occupée*/
+            VACANT /*!< l'entrée est libre*/
+        };
+
+        /**
+         * \class EntreeHachage
+         *
+         * \brief Classe interne pour définir une entrée dans la table
+         *
+         */
+        class EntreeHachage {
+        public:
+            TypeClef m_clef; /*!< la clé de hachage*/
+            TypeElement m_el; /*!< la valeur associée à la clé*/
+            EtatEntree m_info; /*!< tag pour préciser l'état de l'entrée */
+
+            EntreeHachage() :
+                    m_info(VACANT) {
+            }
+        };
+
+        /**
+         * \struct ResultatSondage
+         *
+         * \brief Résultat d'une seule séquence de sondage pour une clef
+         */
+        struct ResultatSondage {
+            size_t index; /*!< la position de la clef, ou la position vacante où l'insérer */
+            bool trouvee; /*!< true si la clef est présente à index */
+            size_t collisions; /*!< le nombre d'entrées occupées rencontrées avant index */
+        };
+
+        // Attributs
+
+        size_t m_tailleTable;
+        std::vector<EntreeHachage> m_tab; /*!< La table de hachage */
+        size_t m_cardinalite; /*!< Le nombre d'éléments actifs dans la table */
+        static const int TAUX_MAX = 50; /*!< Taux de remplissage maximum dans la table */
+        FoncteurHachage m_hachage; /*!< Foncteur de hachage */
+
+        unsigned long m_nInsertions /*!< Nombre d'insertions au total*/;
+        unsigned long m_nCollisions; /*!< Le nombre de collisions au total*/
+
+        // Méthodes privées
+
+        ResultatSondage _sonder(const TypeClef &) const;
+
+        size_t _suivante(size_t) const;
+
+        size_t _distance(size_t) const;
+
+        bool _doitEtreRehachee() const;
+
+        bool _estVacante(size_t) const;
+
+        void _statistiques(const unsigned long &);
+    };
+} //Fin du namespace
+
+#include "TableHachageLineaire.hpp"
+
+#endif
@@ -0,0 +1,330 @@
+#include "ContratException.h"
+#include "OutilsHachage.h"
+#include <utility>
+#include <vector>
+
+namespace labTableHachage {
+
+    /**
+     * @brief Constructeur
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param n La cardinalité approximative du vecteur contenant la table de dispersion.  Cette cardinalité sera en fait
+     * le nombre premier suivant n.
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::TableHachageLineaire(size_t n) :
+            m_tailleTable(prochainPremier(n)),
+            m_tab(m_tailleTable),
+            m_cardinalite(0),
+            m_hachage(m_tailleTable),
+            m_nInsertions(0), m_nCollisions(0) {}
+
+    /**
+     * @brief Ajoute une paire clef-valeur dans la table de dispersion
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur de la paire clef-valeur
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::inserer(const TypeClef &clef,
+                                                                               const TypeElement &element) {
+        ResultatSondage resultat = _sonder(clef);
+        PRECONDITION(!resultat.trouvee);
+        EntreeHachage &entree = m_tab[resultat.index];
+        entree.m_clef = clef;
+        entree.m_el = element;
+        entree.m_info = OCCUPE;
+        ++m_cardinalite;
+        _statistiques(resultat.collisions);
+        if (_doitEtreRehachee()) rehacher();
+    }
+
+    /**
+     * @brief Retirer une paire clef-valeur de la table de dispersion. Les entrées suivantes de la grappe qui peuvent
+     * être rapprochées de leur position de départ reculent dans le trou laissé, jusqu'à la première position vacante.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clé de la paire clef-valeur à retirer
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::enlever(const TypeClef &clef) {
+        ResultatSondage resultat = _sonder(clef);
+        PRECONDITION(resultat.trouvee);
+        size_t trou = resultat.index;
+        size_t distanceTrou = 0;
+        for (size_t i = _suivante(trou); !_estVacante(i); i = _suivante(i)) {
+            ++distanceTrou;
+            if (_distance(i) < distanceTrou) continue;
+            m_tab[trou] = std::move(m_tab[i]);
+            trou = i;
+            distanceTrou = 0;
+        }
+        m_tab[trou].m_info = VACANT;
+        --m_cardinalite;
+    }
+
+    /**
+     * @brief Vérifie la présence d'une paire clef-valeur dans la table, à partir de la clef
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef la clef de la paire clef-valeur cherchée
+     * @return true si la clef est présente dans la table
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::contient(const TypeClef &clef) const {
+        return _sonder(clef).trouvee;
+    }
+
+    /**
+     * @brief Retourne la valeur correspondant à une clef donnée
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return La valeur correspondant à la clef
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    TypeElement TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::element(const TypeClef &clef) const {
+        ResultatSondage resultat = _sonder(clef);
+        PRECONDITION(resultat.trouvee);
+        return m_tab[resultat.index].m_el;
+    }
+
+    /**
+     * @brief Cherche la valeur correspondant à une clef en une seule séquence de sondage
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente. Le pointeur est invalidé par
+     * la prochaine insertion ou le prochain retrait.
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    TypeElement *TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::trouver(const TypeClef &clef) {
+        ResultatSondage resultat = _sonder(clef);
+        return resultat.trouvee ? &m_tab[resultat.index].m_el : nullptr;
+    }
+
+    /**
+     * @brief Version constante de trouver
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    const TypeElement *
+    TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::trouver(const TypeClef &clef) const {
+        ResultatSondage resultat = _sonder(clef);
+        return resultat.trouvee ? &m_tab[resultat.index].m_el : nullptr;
+    }
+
+    /**
+     * @brief Agrandit la table au nombre premier suivant immédiatement le double de la taille actuelle
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::rehacher() {
+        std::vector<EntreeHachage> ancienne;
+        ancienne.swap(m_tab);
+        m_tailleTable = prochainPremier(2 * m_tailleTable);
+        m_tab.resize(m_tailleTable);
+        m_hachage = FoncteurHachage(m_tailleTable);
+        for (auto &entree: ancienne) {
+            if (entree.m_info != OCCUPE) continue;
+            ResultatSondage resultat = _sonder(entree.m_clef);
+            m_tab[resultat.index] = std::move(entree);
+            _statistiques(resultat.collisions);
+        }
+    }
+
+    /**
+     * @brief Enlève tous les éléments de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::vider() {
+        for (auto &entree: m_tab) entree.m_info = VACANT;
+        m_cardinalite = 0;
+    }
+
+    /**
+     * @brief Donne le nombre d'éléments dans la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return Le nombre d'éléments de la table de dispersion
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    int TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::taille() const {
+        return m_cardinalite;
+    }
+
+    /**
+     * @brief Donne le taux moyen de collisions: le nombre total de collisions divisé par le nombre d'insertions
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return Le nombre de collisions divisé par le nombre d'insertions
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    double TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::statistiques() const {
+        PRECONDITION(taille() > 0);
+        return static_cast<double>(m_nCollisions) / static_cast<double>(m_nInsertions);
+    }
+
+    /**
+     * @brief Donne la longueur moyenne de la séquence de sondage d'une recherche réussie, pour le contenu actuel de
+     * la table: la distance moyenne entre chaque entrée et sa position de départ, plus un.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return Le nombre moyen de positions sondées pour trouver une clef présente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    double TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::longueurSondageMoyenne() const {
+        PRECONDITION(taille() > 0);
+        size_t total = 0;
+        for (size_t i = 0; i < m_tailleTable; ++i) {
+            if (!_estVacante(i)) total += _distance(i) + 1;
+        }
+        return static_cast<double>(total) / static_cast<double>(m_cardinalite);
+    }
+
+    /**
+     * @brief Insère la liste des paires clé-valeur de la table dans un flux de sortie
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param p_out Le flux de sortie
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::afficher(std::ostream &p_out) const {
+        p_out << "{";
+        for (size_t i = 0; i < m_tailleTable; ++i) {
+            if (!_estVacante(i)) {
+                p_out << "(" << m_tab[i].m_clef << "," << m_tab[i].m_el << "),";
+            }
+        }
+        p_out << "}";
+    }
+
+    /**
+     * @brief Opérateur d'insertion dans un flux de sortie
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param p_out
+     * @param p_source
+     * @return
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    std::ostream &operator<<(std::ostream &p_out,
+                             const TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage> &p_source) {
+        p_source.afficher(p_out);
+        return p_out;
+    }
+
+    /**
+     * @brief Parcourt les positions consécutives à partir de la position de départ de la clef, jusqu'à la clef ou à
+     * la première position vacante.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef souhaitée
+     * @return La position de la clef si elle est présente, sinon la position vacante qui termine la grappe
+     * @except AssertionError si un nombre excessif de collisions est rencontré
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    typename TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::ResultatSondage
+    TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::_sonder(const TypeClef &clef) const {
+        ResultatSondage resultat = {m_hachage(clef, 0), false, 0};
+        while (!_estVacante(resultat.index)) {
+            if (m_tab[resultat.index].m_clef == clef) {
+                resultat.trouvee = true;
+                return resultat;
+            }
+            resultat.index = _suivante(resultat.index);
+            ++resultat.collisions;
+            ASSERTION(resultat.collisions < MAX_TENTATIVES);
+        }
+        return resultat;
+    }
+
+    /**
+     * @brief Donne la position qui suit une position donnée, en revenant au début à la fin de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param i Un index dans la table
+     * @return L'index suivant
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    size_t TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::_suivante(size_t i) const {
+        return i + 1 == m_tailleTable ? 0 : i + 1;
+    }
+
+    /**
+     * @brief Donne la distance entre une entrée occupée et sa position de départ
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param i L'index d'une entrée occupée
+     * @return Le nombre de positions entre H(clef, 0) et i
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    size_t TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::_distance(size_t i) const {
+        size_t depart = m_hachage(m_tab[i].m_clef, 0);
+        return i >= depart ? i - depart : i + m_tailleTable - depart;
+    }
+
+    /**
+     * @brief Indique si le taux d'occupation de la table est supérieur à TAUX_MAX
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return true si le taux d'occupation de la table est supérieur à TAUX_MAX
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::_doitEtreRehachee() const {
+        return 100 * m_cardinalite > TAUX_MAX * m_tailleTable;
+    }
+
+    /**
+     * @brief Indique si un index donnée indique une position vacante
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param i
+     * @return true si la table est vacante en position i
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::_estVacante(size_t i) const {
+        return m_tab[i].m_info == VACANT;
+    }
+
+    /**
+     * @brief À chaque insertion, incrément le nombre d'insertions de 1 et le nombre de collisions du nombre spécifié.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param collisions Le nombre de collisions rencontré lors de la tentative de trouver un index libre
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageLineaire<TypeClef, TypeElement, FoncteurHachage>::_statistiques(const size_t &collisions) {
+        m_nCollisions += collisions;
+        ++m_nInsertions;
+    }
+
+} //Fin du namespace
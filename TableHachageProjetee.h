@@ -0,0 +1,176 @@
+/**
+ * \file TableHachageProjetee.h
+ * \brief Classe définissant une table de hachage en lecture seule projetée en mémoire (mmap) depuis un fichier.
+ * \version 0.4
+ * \date octobre 2026
+ *
+ *	Résolution des collisions par le foncteur de hachage, comme TableHachage. La table est sauvegardée une fois, puis
+ *	chaque processus la projette en mémoire et l'interroge sans rien y insérer.
+ *
+ */
+
+#ifndef TABLEHACHAGEPROJETEE_H_
+#define TABLEHACHAGEPROJETEE_H_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "OutilsHachage.h"
+#include "TableHachage.h"
+
+namespace labTableHachage {
+
+/**
+ * \class TableHachageProjetee
+ *
+ * \brief classe générique représentant une table de dispersion en adressage ouvert, en lecture seule, dont le fichier
+ * est projeté en mémoire par mmap: l'ouverture ne replace aucune entrée, et les pages ne sont lues qu'au besoin
+ *
+ *  Le fichier commence par un en-tête (FormatProjection) qui enregistre la capacité, l'identité du foncteur de
+ *  hachage et des types, et une somme de contrôle de tout le fichier. Suivent le tableau des octets de contrôle (un
+ *  par position, VACANT ou OCCUPE), le tableau des entrées (clef et élément), puis l'arène des clefs chaînes. Chaque
+ *  tableau commence à un multiple de 64 octets. Les positions sont celles que donne FoncteurHachage pour la capacité
+ *  enregistrée: l'ouverture vérifie que l'en-tête correspond aux paramètres de la classe, que la taille du fichier
+ *  correspond à la capacité et, à moins de s'en dispenser, la somme de contrôle.
+ *
+ *  Le format suppose que le fichier est relu sur une machine de même boutisme et par le même compilateur, qui donne
+ *  le même nom aux types (typeid). Réservé aux systèmes POSIX.
+ *
+ * TypeClef : le type des clefs, trivialement copiable, ou std::string. Les clefs std::string sont rangées bout à bout
+ * dans l'arène, chaque entrée conservant la position et la longueur de la sienne; les recherches prennent alors une
+ * std::string_view.
+ * TypeElement : le type des éléments, trivialement copiable
+ * FoncteurHachage: foncteur de hachage, voir FoncteurHachage.hpp. Les recherches utilisent primaire, indice et
+ * suivant lorsqu'il les offre, comme TableHachage.
+ */
+
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    class TableHachageProjetee {
+        /*! Vrai si les clefs sont des chaînes rangées dans l'arène */
+        static const bool CLEFS_CHAINES = std::is_same<TypeClef, std::string>::value;
+
+        static_assert(CLEFS_CHAINES || std::is_trivially_copyable<TypeClef>::value,
+                      "TypeClef doit être trivialement copiable ou std::string");
+        static_assert(std::is_trivially_copyable<TypeElement>::value, "TypeElement doit être trivialement copiable");
+
+    public:
+
+        /*! Le type des clefs cherchées: std::string_view pour des clefs std::string */
+        typedef typename std::conditional<CLEFS_CHAINES, std::string_view, const TypeClef &>::type ClefRecherche;
+
+        explicit TableHachageProjetee(const std::string &, bool = true);
+
+        ~TableHachageProjetee();
+
+        TableHachageProjetee(const TableHachageProjetee &) = delete;
+
+        TableHachageProjetee &operator=(const TableHachageProjetee &) = delete;
+
+        bool contient(ClefRecherche) const;
+
+        const TypeElement &element(ClefRecherche) const;
+
+        const TypeElement *trouver(ClefRecherche) const;
+
+        int taille() const;
+
+        size_t capacite() const;
+
+        template<class PolitiqueCapacite, class Allocateur>
+        static void sauvegarder(const TableHachage<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite,
+                Allocateur> &, const std::string &);
+
+        template<typename IterateurPaires>
+        static void sauvegarder(IterateurPaires, IterateurPaires, size_t, const std::string &);
+
+    private:
+
+        /**
+         * \enum Controle
+         * \brief Les octets de contrôle du fichier. Une table projetée n'a jamais d'entrée effacée.
+         */
+        enum Controle : uint8_t {
+            VACANT = 0, /*!< l'entrée n'a jamais été utilisé*/
+            OCCUPE = 1 /*!< l'entrée est occupée*/
+        };
+
+        /**
+         * \struct ClefArene
+         * \brief Une clef chaîne conservée dans une entrée: sa position et sa longueur dans l'arène
+         */
+        struct ClefArene {
+            uint64_t m_position; /*!< la position du premier octet de la clef dans l'arène */
+            uint64_t m_longueur; /*!< la longueur de la clef en octets */
+        };
+
+        /*! Le type des clefs dans les entrées du fichier */
+        typedef typename std::conditional<CLEFS_CHAINES, ClefArene, TypeClef>::type ClefStockee;
+
+        /**
+         * \struct EntreeProjetee
+         * \brief Une entrée du fichier, copiée octet par octet
+         */
+        struct EntreeProjetee {
+            ClefStockee m_clef; /*!< la clé de hachage*/
+            TypeElement m_el; /*!< la valeur associée à la clé*/
+        };
+
+        /**
+         * \struct FormatProjection
+         * \brief L'en-tête du fichier
+         */
+        struct FormatProjection {
+            uint64_t m_magie; /*!< MAGIE */
+            uint64_t m_version; /*!< VERSION */
+            uint64_t m_identiteHacheur; /*!< le hash du nom de FoncteurHachage */
+            uint64_t m_identiteTypes; /*!< le hash des noms et des tailles de TypeClef et TypeElement */
+            uint64_t m_capacite; /*!< le nombre de positions de la table */
+            uint64_t m_cardinalite; /*!< le nombre d'entrées occupées */
+            uint64_t m_octetsArene; /*!< la taille de l'arène des clefs chaînes */
+            uint64_t m_sommeControle; /*!< la somme de contrôle du reste de l'en-tête et de tout ce qui le suit */
+        };
+
+        static const uint64_t MAGIE = 0x31304A4F52504854ULL; /*!< "THPROJ01" en petit-boutiste */
+        static const uint64_t VERSION = 1;
+        static const size_t ALIGNEMENT = 64; /*!< L'alignement de chaque tableau dans le fichier */
+
+        // Attributs
+
+        size_t m_octets; /*!< La taille du fichier projeté */
+        const char *m_projection; /*!< Le début du fichier projeté */
+        size_t m_tailleTable;
+        size_t m_cardinalite; /*!< Le nombre d'éléments dans la table */
+        const uint8_t *m_controle; /*!< Les octets de contrôle, un par position */
+        const EntreeProjetee *m_entrees; /*!< Les entrées, une par position */
+        const char *m_arene; /*!< Les octets des clefs chaînes, bout à bout */
+        FoncteurHachage m_hachage; /*!< Foncteur de hachage */
+
+        // Méthodes privées
+
+        template<typename Egalite>
+        static size_t _sonder(const FoncteurHachage &, const uint8_t *, ClefRecherche, Egalite);
+
+        static bool _clefEgale(const EntreeProjetee &, const char *, ClefRecherche);
+
+        static const char *_projeter(const std::string &, bool, size_t &);
+
+        static size_t _aligner(size_t);
+
+        static size_t _decalageEntrees(size_t);
+
+        static size_t _decalageArene(size_t);
+
+        static uint64_t _identiteHacheur();
+
+        static uint64_t _identiteTypes();
+
+        static uint64_t _sommeControle(const char *, size_t, uint64_t);
+
+        static uint64_t _sommeControleFichier(const char *, size_t);
+    };
+} //Fin du namespace
+
+#include "TableHachageProjetee.hpp"
+
+#endif
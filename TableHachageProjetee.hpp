@@ -0,0 +1,425 @@
+#include "ContratException.h"
+#include "OutilsHachage.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <typeinfo>
+#include <vector>
+
+namespace labTableHachage {
+
+    /**
+     * @brief Constructeur: projette un fichier écrit par sauvegarder en mémoire, en lecture seule, et valide son
+     * en-tête. Aucune entrée n'est lue ni replacée; la table est aussitôt prête à être interrogée.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param fichier Le chemin du fichier
+     * @param verifier true pour vérifier la somme de contrôle, ce qui lit tout le fichier une fois
+     * @except std::runtime_error si le fichier ne peut être projeté, si son en-tête ne correspond pas à la classe, si
+     * sa taille ne correspond pas à l'en-tête ou si la somme de contrôle vérifiée est fausse
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::TableHachageProjetee(const std::string &fichier,
+                                                                                       bool verifier) :
+            m_octets(0),
+            m_projection(_projeter(fichier, verifier, m_octets)),
+            m_tailleTable(reinterpret_cast<const FormatProjection *>(m_projection)->m_capacite),
+            m_cardinalite(reinterpret_cast<const FormatProjection *>(m_projection)->m_cardinalite),
+            m_controle(reinterpret_cast<const uint8_t *>(m_projection + _aligner(sizeof(FormatProjection)))),
+            m_entrees(reinterpret_cast<const EntreeProjetee *>(m_projection + _decalageEntrees(m_tailleTable))),
+            m_arene(m_projection + _decalageArene(m_tailleTable)),
+            m_hachage(m_tailleTable) {}
+
+    /**
+     * @brief Destructeur: retire la projection du fichier
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::~TableHachageProjetee() {
+        munmap(const_cast<char *>(m_projection), m_octets);
+    }
+
+    /**
+     * @brief Vérifie la présence d'une paire clef-valeur dans la table, à partir de la clef
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef la clef de la paire clef-valeur cherchée
+     * @return true si la clef est présente dans la table
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::contient(ClefRecherche clef) const {
+        return trouver(clef) != nullptr;
+    }
+
+    /**
+     * @brief Retourne la valeur correspondant à une clef donnée
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Une référence sur la valeur dans le fichier projeté
+     * @except PreconditionException si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    const TypeElement &TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::element(ClefRecherche clef) const {
+        const TypeElement *el = trouver(clef);
+        PRECONDITION(el != nullptr);
+        return *el;
+    }
+
+    /**
+     * @brief Cherche la valeur correspondant à une clef en une seule séquence de sondage
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans le fichier projeté, ou nullptr si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    const TypeElement *
+    TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::trouver(ClefRecherche clef) const {
+        size_t index = _sonder(m_hachage, m_controle, clef, [this, clef](size_t i) {
+            return _clefEgale(m_entrees[i], m_arene, clef);
+        });
+        return m_controle[index] == OCCUPE ? &m_entrees[index].m_el : nullptr;
+    }
+
+    /**
+     * @brief Donne le nombre d'éléments dans la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return Le nombre d'éléments de la table de dispersion
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    int TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::taille() const {
+        return m_cardinalite;
+    }
+
+    /**
+     * @brief Donne la capacité de la table, enregistrée dans le fichier
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return Le nombre de positions de la table
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    size_t TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::capacite() const {
+        return m_tailleTable;
+    }
+
+    /**
+     * @brief Sauvegarde les paires d'une TableHachage dans un fichier que TableHachageProjetee peut projeter, avec la
+     * capacité de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam PolitiqueCapacite
+     * @tparam Allocateur
+     * @param table La table à sauvegarder
+     * @param fichier Le chemin du fichier, remplacé s'il existe
+     * @except std::runtime_error si le fichier ne peut être écrit
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    template<class PolitiqueCapacite, class Allocateur>
+    void TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::sauvegarder(
+            const TableHachage<TypeClef, TypeElement, FoncteurHachage, PolitiqueCapacite, Allocateur> &table,
+            const std::string &fichier) {
+        sauvegarder(table.begin(), table.end(), table.capacite(), fichier);
+    }
+
+    /**
+     * @brief Sauvegarde une plage de paires clef-valeur dans un fichier que TableHachageProjetee peut projeter. Les
+     * paires sont placées dans un tableau de la capacité donnée par les séquences de sondage de FoncteurHachage.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam IterateurPaires Un itérateur avant sur des paires dont first est la clef et second la valeur
+     * @param debut Le début de la plage
+     * @param fin La fin de la plage
+     * @param capacite La capacité de la table, valide pour FoncteurHachage. Le nombre de paires ne doit pas en dépasser
+     * le taux que la séquence de sondage supporte (TauxMaxSondage, 50% pour le sondage quadratique).
+     * @param fichier Le chemin du fichier, remplacé s'il existe
+     * @except PreconditionException si une clef apparaît plus d'une fois ou si la capacité est trop petite
+     * @except std::runtime_error si le fichier ne peut être écrit
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    template<typename IterateurPaires>
+    void TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::sauvegarder(
+            IterateurPaires debut, IterateurPaires fin, size_t capacite, const std::string &fichier) {
+        size_t cardinalite = 0, octetsArene = 0;
+        for (IterateurPaires it = debut; it != fin; ++it) {
+            ++cardinalite;
+            if constexpr (CLEFS_CHAINES) octetsArene += (*it).first.size();
+        }
+        PRECONDITION(100 * cardinalite <= static_cast<size_t>(TauxMaxSondage<FoncteurHachage>::value) * capacite);
+        FoncteurHachage hachage(capacite);
+
+        std::vector<char> contenu(_decalageArene(capacite) + octetsArene);
+        uint8_t *controle = reinterpret_cast<uint8_t *>(contenu.data() + _aligner(sizeof(FormatProjection)));
+        EntreeProjetee *entrees = reinterpret_cast<EntreeProjetee *>(contenu.data() + _decalageEntrees(capacite));
+        char *arene = contenu.data() + _decalageArene(capacite);
+        size_t position = 0;
+        for (IterateurPaires it = debut; it != fin; ++it) {
+            ClefRecherche clef = (*it).first;
+            size_t index = _sonder(hachage, controle, clef, [entrees, arene, clef](size_t i) {
+                return _clefEgale(entrees[i], arene, clef);
+            });
+            PRECONDITION(controle[index] == VACANT);
+            EntreeProjetee entree;
+            std::memset(&entree, 0, sizeof(entree));
+            if constexpr (CLEFS_CHAINES) {
+                std::memcpy(arene + position, clef.data(), clef.size());
+                entree.m_clef.m_position = position;
+                entree.m_clef.m_longueur = clef.size();
+                position += clef.size();
+            } else {
+                entree.m_clef = clef;
+            }
+            entree.m_el = (*it).second;
+            std::memcpy(&entrees[index], &entree, sizeof(entree));
+            controle[index] = OCCUPE;
+        }
+
+        FormatProjection entete = {MAGIE, VERSION, _identiteHacheur(), _identiteTypes(), capacite, cardinalite,
+                                   octetsArene, 0};
+        std::memcpy(contenu.data(), &entete, sizeof(entete));
+        entete.m_sommeControle = _sommeControleFichier(contenu.data(), contenu.size());
+        std::memcpy(contenu.data(), &entete, sizeof(entete));
+
+        std::ofstream flux(fichier, std::ios::binary | std::ios::trunc);
+        flux.write(contenu.data(), static_cast<std::streamsize>(contenu.size()));
+        if (!flux) throw std::runtime_error("TableHachageProjetee: impossible d'écrire " + fichier);
+    }
+
+    /**
+     * @brief Parcourt une seule fois la séquence de sondage d'une clef dans un tableau d'octets de contrôle, jusqu'à
+     * la clef ou jusqu'à une position vacante. Hache la clef une seule fois si le foncteur offre suivant.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @tparam Egalite Un objet-fonction qui indique si la clef de l'entrée occupée d'une position est la clef cherchée
+     * @param hachage Le foncteur de hachage de la capacité du tableau
+     * @param controle Les octets de contrôle
+     * @param clef La clef souhaitée
+     * @param egale L'objet-fonction de comparaison
+     * @return La position de la clef si elle est présente, sinon la première position vacante de sa séquence
+     * @except AssertionError si un nombre excessif de collisions est rencontré
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    template<typename Egalite>
+    size_t TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::_sonder(
+            const FoncteurHachage &hachage, const uint8_t *controle, ClefRecherche clef, Egalite egale) {
+        size_t hash = 0;
+        size_t index;
+        if constexpr (SondageIncremental<FoncteurHachage>::value) {
+            hash = hachage.primaire(clef);
+            index = hachage.indice(hash, 0);
+        } else {
+            index = hachage(clef, 0);
+        }
+        size_t tentative = 1;
+        while (controle[index] != VACANT && !egale(index)) {
+            if constexpr (SondageIncremental<FoncteurHachage>::value) {
+                index = hachage.suivant(index, hash, tentative);
+            } else {
+                index = hachage(clef, tentative);
+            }
+            ++tentative;
+            ASSERTION(tentative < MAX_TENTATIVES);
+        }
+        return index;
+    }
+
+    /**
+     * @brief Compare la clef d'une entrée occupée à une clef cherchée: octet par octet dans l'arène pour des clefs
+     * chaînes, par == sinon
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param entree Une entrée occupée
+     * @param arene L'arène des clefs chaînes
+     * @param clef La clef cherchée
+     * @return true si les clefs sont égales
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::_clefEgale(const EntreeProjetee &entree,
+                                                                                 const char *arene,
+                                                                                 ClefRecherche clef) {
+        if constexpr (CLEFS_CHAINES) {
+            return entree.m_clef.m_longueur == clef.size() &&
+                   std::string_view(arene + entree.m_clef.m_position, entree.m_clef.m_longueur) == clef;
+        } else {
+            (void) arene;
+            return entree.m_clef == clef;
+        }
+    }
+
+    /**
+     * @brief Projette un fichier en mémoire en lecture seule et valide son en-tête, sa taille et, au besoin, sa somme
+     * de contrôle. La projection est retirée avant toute exception.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param fichier Le chemin du fichier
+     * @param verifier true pour vérifier la somme de contrôle
+     * @param octets Reçoit la taille du fichier
+     * @return Le début du fichier projeté
+     * @except std::runtime_error si le fichier ne peut être projeté ou n'est pas valide
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    const char *TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::_projeter(const std::string &fichier,
+                                                                                       bool verifier, size_t &octets) {
+        int descripteur = open(fichier.c_str(), O_RDONLY);
+        if (descripteur < 0) throw std::runtime_error("TableHachageProjetee: impossible d'ouvrir " + fichier);
+        struct stat etat;
+        if (fstat(descripteur, &etat) != 0 || static_cast<size_t>(etat.st_size) < sizeof(FormatProjection)) {
+            close(descripteur);
+            throw std::runtime_error("TableHachageProjetee: fichier trop court " + fichier);
+        }
+        octets = static_cast<size_t>(etat.st_size);
+        void *projection = mmap(nullptr, octets, PROT_READ, MAP_SHARED, descripteur, 0);
+        close(descripteur);
+        if (projection == MAP_FAILED) {
+            throw std::runtime_error("TableHachageProjetee: impossible de projeter " + fichier);
+        }
+
+        const char *debut = static_cast<const char *>(projection);
+        const FormatProjection &entete = *reinterpret_cast<const FormatProjection *>(debut);
+        const char *erreur = nullptr;
+        if (entete.m_magie != MAGIE || entete.m_version != VERSION) {
+            erreur = "format inconnu";
+        } else if (entete.m_identiteHacheur != _identiteHacheur() || entete.m_identiteTypes != _identiteTypes()) {
+            erreur = "foncteur de hachage ou types différents";
+        } else if (entete.m_capacite == 0 || entete.m_capacite > octets || entete.m_cardinalite >= entete.m_capacite ||
+                   entete.m_octetsArene > octets ||
+                   _decalageArene(entete.m_capacite) + entete.m_octetsArene != octets) {
+            erreur = "taille incohérente avec l'en-tête";
+        } else if (verifier && _sommeControleFichier(debut, octets) != entete.m_sommeControle) {
+            erreur = "somme de contrôle fausse";
+        }
+        if (erreur) {
+            munmap(projection, octets);
+            throw std::runtime_error(std::string("TableHachageProjetee: ") + erreur + " dans " + fichier);
+        }
+        return debut;
+    }
+
+    /**
+     * @brief Arrondit une taille au multiple de ALIGNEMENT suivant
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param octets Une taille en octets
+     * @return La plus petite taille multiple de ALIGNEMENT qui contient octets
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    size_t TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::_aligner(size_t octets) {
+        return (octets + ALIGNEMENT - 1) / ALIGNEMENT * ALIGNEMENT;
+    }
+
+    /**
+     * @brief Donne la position du tableau des entrées dans le fichier, après l'en-tête et les octets de contrôle
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param capacite La capacité de la table
+     * @return La position en octets
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    size_t TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::_decalageEntrees(size_t capacite) {
+        return _aligner(sizeof(FormatProjection)) + _aligner(capacite);
+    }
+
+    /**
+     * @brief Donne la position de l'arène des clefs chaînes dans le fichier, après le tableau des entrées
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param capacite La capacité de la table
+     * @return La position en octets, qui est la taille du fichier sans l'arène
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    size_t TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::_decalageArene(size_t capacite) {
+        return _decalageEntrees(capacite) + _aligner(capacite * sizeof(EntreeProjetee));
+    }
+
+    /**
+     * @brief Identifie FoncteurHachage par le hash de son nom, qui inclut ses paramètres de modèle
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return L'identité enregistrée dans l'en-tête
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    uint64_t TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::_identiteHacheur() {
+        const char *nom = typeid(FoncteurHachage).name();
+        return _sommeControle(nom, std::strlen(nom), 0xcbf29ce484222325ULL);
+    }
+
+    /**
+     * @brief Identifie TypeClef et TypeElement par le hash de leurs noms et de la taille des entrées
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return L'identité enregistrée dans l'en-tête
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    uint64_t TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::_identiteTypes() {
+        std::string noms = std::string(typeid(TypeClef).name()) + "," + typeid(TypeElement).name() + "," +
+                           std::to_string(sizeof(EntreeProjetee));
+        return _sommeControle(noms.data(), noms.size(), 0xcbf29ce484222325ULL);
+    }
+
+    /**
+     * @brief Somme de contrôle FNV-1a calculée par mots de 8 octets, puis octet par octet pour la fin
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param p_octets Le début des octets
+     * @param n Le nombre d'octets
+     * @param somme La somme des octets précédents, ou la base FNV pour commencer
+     * @return La somme de contrôle
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    uint64_t TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::_sommeControle(
+            const char *p_octets, size_t n, uint64_t somme) {
+        const uint64_t PREMIER = 0x100000001b3ULL;
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8) {
+            uint64_t mot;
+            std::memcpy(&mot, p_octets + i, sizeof(mot));
+            somme = (somme ^ mot) * PREMIER;
+        }
+        for (; i < n; ++i) somme = (somme ^ static_cast<unsigned char>(p_octets[i])) * PREMIER;
+        return somme;
+    }
+
+    /**
+     * @brief Somme de contrôle d'un fichier complet: l'en-tête sans le champ de la somme, puis tout ce qui le suit
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param debut Le début du fichier
+     * @param octets La taille du fichier
+     * @return La somme de contrôle enregistrée dans l'en-tête
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    uint64_t TableHachageProjetee<TypeClef, TypeElement, FoncteurHachage>::_sommeControleFichier(const char *debut,
+                                                                                                size_t octets) {
+        const size_t champ = offsetof(FormatProjection, m_sommeControle);
+        uint64_t somme = _sommeControle(debut, champ, 0xcbf29ce484222325ULL);
+        const size_t suite = champ + sizeof(uint64_t);
+        return _sommeControle(debut + suite, octets - suite, somme);
+    }
+
+} //Fin du namespace
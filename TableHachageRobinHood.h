@@ -0,0 +1,131 @@
+/**
+ * \file TableHachageRobinHood.h
+ * \brief Classe définissant une table de hachage à sondage linéaire avec insertion Robin Hood.
+ * \version 0.4
+ * \date octobre 2026
+ *
+ *	Résolution des collisions par redistribution linéaire. Chaque entrée conserve sa distance à sa position de
+ *	départ; une insertion prend la place de toute entrée plus proche de sa position de départ qu'elle ne l'est de la
+ *	sienne, ce qui égalise les longueurs des séquences de sondage.
+ *
+ */
+
+#ifndef TABLEHACHAGEROBINHOOD_H_
+#define TABLEHACHAGEROBINHOOD_H_
+
+#include <ostream>
+#include <vector>
+#include "OutilsHachage.h"
+
+namespace labTableHachage {
+
+/**
+ * \class TableHachageRobinHood
+ *
+ * \brief classe générique représentant une table de dispersion en adressage ouvert avec insertion Robin Hood
+ *
+ *  Les entrées d'une grappe sont ordonnées par distance à leur position de départ. Une recherche infructueuse
+ *  s'arrête donc dès que la distance parcourue dépasse celle de l'entrée rencontrée. Le retrait recule les entrées
+ *  suivantes de la grappe, sans laisser d'entrée effacée.
+ *
+ * TypeClef : le type des clefs
+ * TypeElement : le type des éléments
+ * FoncteurHachage: foncteur de hachage. Seule la position de départ H(clef, 0) est utilisée. Voir
+ * FoncteurHachage.hpp
+ */
+
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    class TableHachageRobinHood {
+    public:
+
+        TableHachageRobinHood(size_t = 100);
+
+        void inserer(const TypeClef &, const TypeElement &);
+
+        void enlever(const TypeClef &);
+
+        bool contient(const TypeClef &) const;
+
+        TypeElement element(const TypeClef &) const;
+
+        TypeElement *trouver(const TypeClef &);
+
+        const TypeElement *trouver(const TypeClef &) const;
+
+        void rehacher();
+
+        void vider();
+
+        int taille() const;
+
+        double statistiques() const;
+
+        int distanceMaximale() const;
+
+        void afficher(std::ostream &) const;
+
+        template<typename TClef, typename TElement, class FHachage>
+        friend std::ostream &operator<<(std::ostream &,
+                                        const TableHachageRobinHood<TClef, TElement, FHachage> &);
+
+    private:
+
+        /**
+         * \class EntreeHachage
+         *
+         * \brief Classe interne pour définir une entrée dans la table
+         *
+         */
+        class EntreeHachage {
+        public:
+            TypeClef m_clef; /*!< la clé de hachage*/
+            TypeElement m_el; /*!< la valeur associée à la clé*/
+            int m_distance; /*!< la distance à la position de départ de la clef, ou VACANTE */
+
+            EntreeHachage() :
+                    m_distance(VACANTE) {
+            }
+        };
+
+        /**
+         * \struct ResultatSondage
+         *
+         * \brief Résultat d'une seule séquence de sondage pour une clef
+         */
+        struct ResultatSondage {
+            size_t index; /*!< la position de la clef, ou la position où l'insérer */
+            bool trouvee; /*!< true si la clef est présente à index */
+            int distance; /*!< la distance entre index et la position de départ de la clef */
+        };
+
+        // Attributs
+
+        static const int VACANTE = -1; /*!< La distance d'une entrée vacante */
+        size_t m_tailleTable;
+        std::vector<EntreeHachage> m_tab; /*!< La table de hachage */
+        size_t m_cardinalite; /*!< Le nombre d'éléments actifs dans la table */
+        static const int TAUX_MAX = 50; /*!< Taux de remplissage maximum dans la table */
+        FoncteurHachage m_hachage; /*!< Foncteur de hachage */
+
+        unsigned long m_nInsertions /*!< Nombre d'insertions au total*/;
+        unsigned long m_nCollisions; /*!< Le nombre de collisions au total*/
+
+        // Méthodes privées
+
+        ResultatSondage _sonder(const TypeClef &) const;
+
+        void _placer(const ResultatSondage &, EntreeHachage);
+
+        size_t _suivante(size_t) const;
+
+        bool _doitEtreRehachee() const;
+
+        bool _estVacante(size_t) const;
+
+        void _statistiques(const unsigned long &);
+    };
+} //Fin du namespace
+
+#include "TableHachageRobinHood.hpp"
+
+#endif
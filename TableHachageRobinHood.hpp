@@ -0,0 +1,333 @@
+#include "ContratException.h"
+#include "OutilsHachage.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace labTableHachage {
+
+    /**
+     * @brief Constructeur
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param n La cardinalité approximative du vecteur contenant la table de dispersion.  Cette cardinalité sera en fait
+     * le nombre premier suivant n.
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::TableHachageRobinHood(size_t n) :
+            m_tailleTable(prochainPremier(n)),
+            m_tab(m_tailleTable),
+            m_cardinalite(0),
+            m_hachage(m_tailleTable),
+            m_nInsertions(0), m_nCollisions(0) {}
+
+    /**
+     * @brief Ajoute une paire clef-valeur dans la table de dispersion
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clé de la paire clef-valeur
+     * @param element La valeur de la paire clef-valeur
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::inserer(const TypeClef &clef,
+                                                                                const TypeElement &element) {
+        ResultatSondage resultat = _sonder(clef);
+        PRECONDITION(!resultat.trouvee);
+        EntreeHachage entree;
+        entree.m_clef = clef;
+        entree.m_el = element;
+        _placer(resultat, std::move(entree));
+        ++m_cardinalite;
+        if (_doitEtreRehachee()) rehacher();
+    }
+
+    /**
+     * @brief Retirer une paire clef-valeur de la table de dispersion. Les entrées suivantes de la grappe qui ne sont
+     * pas à leur position de départ reculent d'une position.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clé de la paire clef-valeur à retirer
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::enlever(const TypeClef &clef) {
+        ResultatSondage resultat = _sonder(clef);
+        PRECONDITION(resultat.trouvee);
+        size_t trou = resultat.index;
+        for (size_t i = _suivante(trou); m_tab[i].m_distance > 0; i = _suivante(i)) {
+            m_tab[trou] = std::move(m_tab[i]);
+            --m_tab[trou].m_distance;
+            trou = i;
+        }
+        m_tab[trou].m_distance = VACANTE;
+        --m_cardinalite;
+    }
+
+    /**
+     * @brief Vérifie la présence d'une paire clef-valeur dans la table, à partir de la clef
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef la clef de la paire clef-valeur cherchée
+     * @return true si la clef est présente dans la table
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::contient(const TypeClef &clef) const {
+        return _sonder(clef).trouvee;
+    }
+
+    /**
+     * @brief Retourne la valeur correspondant à une clef donnée
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return La valeur correspondant à la clef
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    TypeElement TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::element(const TypeClef &clef) const {
+        ResultatSondage resultat = _sonder(clef);
+        PRECONDITION(resultat.trouvee);
+        return m_tab[resultat.index].m_el;
+    }
+
+    /**
+     * @brief Cherche la valeur correspondant à une clef en une seule séquence de sondage
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente. Le pointeur est invalidé par
+     * la prochaine insertion ou le prochain retrait.
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    TypeElement *TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::trouver(const TypeClef &clef) {
+        ResultatSondage resultat = _sonder(clef);
+        return resultat.trouvee ? &m_tab[resultat.index].m_el : nullptr;
+    }
+
+    /**
+     * @brief Version constante de trouver
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef de la paire clef-valeur cherchée
+     * @return Un pointeur sur la valeur dans la table, ou nullptr si la clef est absente
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    const TypeElement *
+    TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::trouver(const TypeClef &clef) const {
+        ResultatSondage resultat = _sonder(clef);
+        return resultat.trouvee ? &m_tab[resultat.index].m_el : nullptr;
+    }
+
+    /**
+     * @brief Agrandit la table au nombre premier suivant immédiatement le double de la taille actuelle
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::rehacher() {
+        std::vector<EntreeHachage> ancienne;
+        ancienne.swap(m_tab);
+        m_tailleTable = prochainPremier(2 * m_tailleTable);
+        m_tab.resize(m_tailleTable);
+        m_hachage = FoncteurHachage(m_tailleTable);
+        for (auto &entree: ancienne) {
+            if (entree.m_distance == VACANTE) continue;
+            ResultatSondage resultat = _sonder(entree.m_clef);
+            _placer(resultat, std::move(entree));
+        }
+    }
+
+    /**
+     * @brief Enlève tous les éléments de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::vider() {
+        for (auto &entree: m_tab) entree.m_distance = VACANTE;
+        m_cardinalite = 0;
+    }
+
+    /**
+     * @brief Donne le nombre d'éléments dans la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return Le nombre d'éléments de la table de dispersion
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    int TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::taille() const {
+        return m_cardinalite;
+    }
+
+    /**
+     * @brief Donne le taux moyen de collisions: le nombre total de collisions divisé par le nombre d'insertions
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return Le nombre de collisions divisé par le nombre d'insertions
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    double TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::statistiques() const {
+        PRECONDITION(taille() > 0);
+        return static_cast<double>(m_nCollisions) / static_cast<double>(m_nInsertions);
+    }
+
+    /**
+     * @brief Donne la plus grande distance entre une entrée et sa position de départ, soit la longueur de la plus
+     * longue séquence de sondage d'une recherche réussie, moins un.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return La distance maximale, ou VACANTE si la table est vide
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    int TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::distanceMaximale() const {
+        int maximum = VACANTE;
+        for (const auto &entree: m_tab) maximum = std::max(maximum, entree.m_distance);
+        return maximum;
+    }
+
+    /**
+     * @brief Insère la liste des paires clé-valeur de la table dans un flux de sortie
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param p_out Le flux de sortie
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::afficher(std::ostream &p_out) const {
+        p_out << "{";
+        for (size_t i = 0; i < m_tailleTable; ++i) {
+            if (!_estVacante(i)) {
+                p_out << "(" << m_tab[i].m_clef << "," << m_tab[i].m_el << "),";
+            }
+        }
+        p_out << "}";
+    }
+
+    /**
+     * @brief Opérateur d'insertion dans un flux de sortie
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param p_out
+     * @param p_source
+     * @return
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    std::ostream &operator<<(std::ostream &p_out,
+                             const TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage> &p_source) {
+        p_source.afficher(p_out);
+        return p_out;
+    }
+
+    /**
+     * @brief Parcourt les positions consécutives à partir de la position de départ de la clef. La recherche s'arrête
+     * à la clef, à une position vacante, ou dès qu'une entrée est plus proche de sa position de départ que la
+     * distance parcourue: la clef aurait alors pris sa place à l'insertion.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param clef La clef souhaitée
+     * @return La position de la clef si elle est présente, sinon la position où l'insérer
+     * @except AssertionError si un nombre excessif de collisions est rencontré
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    typename TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::ResultatSondage
+    TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::_sonder(const TypeClef &clef) const {
+        ResultatSondage resultat = {m_hachage(clef, 0), false, 0};
+        while (m_tab[resultat.index].m_distance >= resultat.distance) {
+            if (m_tab[resultat.index].m_distance == resultat.distance && m_tab[resultat.index].m_clef == clef) {
+                resultat.trouvee = true;
+                return resultat;
+            }
+            resultat.index = _suivante(resultat.index);
+            ++resultat.distance;
+            ASSERTION(static_cast<size_t>(resultat.distance) < MAX_TENTATIVES);
+        }
+        return resultat;
+    }
+
+    /**
+     * @brief Place une entrée à la position trouvée par _sonder. Chaque entrée déplacée prend à son tour la place de
+     * la première entrée plus proche de sa position de départ, jusqu'à une position vacante.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param resultat Le résultat du sondage de la clef de l'entrée, qui ne doit pas avoir été trouvée
+     * @param entree L'entrée à placer
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::_placer(const ResultatSondage &resultat,
+                                                                                EntreeHachage entree) {
+        _statistiques(resultat.distance);
+        entree.m_distance = resultat.distance;
+        size_t index = resultat.index;
+        while (!_estVacante(index)) {
+            if (m_tab[index].m_distance < entree.m_distance) std::swap(entree, m_tab[index]);
+            index = _suivante(index);
+            ++entree.m_distance;
+        }
+        m_tab[index] = std::move(entree);
+    }
+
+    /**
+     * @brief Donne la position qui suit une position donnée, en revenant au début à la fin de la table
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param i Un index dans la table
+     * @return L'index suivant
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    size_t TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::_suivante(size_t i) const {
+        return i + 1 == m_tailleTable ? 0 : i + 1;
+    }
+
+    /**
+     * @brief Indique si le taux d'occupation de la table est supérieur à TAUX_MAX
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @return true si le taux d'occupation de la table est supérieur à TAUX_MAX
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::_doitEtreRehachee() const {
+        return 100 * m_cardinalite > TAUX_MAX * m_tailleTable;
+    }
+
+    /**
+     * @brief Indique si un index donnée indique une position vacante
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param i
+     * @return true si la table est vacante en position i
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    bool TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::_estVacante(size_t i) const {
+        return m_tab[i].m_distance == VACANTE;
+    }
+
+    /**
+     * @brief À chaque insertion, incrément le nombre d'insertions de 1 et le nombre de collisions du nombre spécifié.
+     * @tparam TypeClef
+     * @tparam TypeElement
+     * @tparam FoncteurHachage
+     * @param collisions Le nombre de positions parcourues avant la position d'insertion
+     */
+    template<typename TypeClef, typename TypeElement, class FoncteurHachage>
+    void TableHachageRobinHood<TypeClef, TypeElement, FoncteurHachage>::_statistiques(const size_t &collisions) {
+        m_nCollisions += collisions;
+        ++m_nInsertions;
+    }
+
+} //Fin du namespace
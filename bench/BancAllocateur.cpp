@@ -0,0 +1,96 @@
+/**
+ * \file BancAllocateur.cpp
+ * \brief Banc d'essai des allocateurs de TableHachage: création, remplissage et destruction de tables éphémères
+ *
+ * Chaque fil répète des cycles où il crée une table de clefs string de 32 octets (hors du tampon interne des
+ * std::string), y insère les clefs, les recherche, puis détruit la table. Compare l'allocateur par défaut, une
+ * pmr::TableHachage sur un std::pmr::unsynchronized_pool_resource propre au fil et le mode arène, une
+ * pmr::TableHachage sur un std::pmr::monotonic_buffer_resource qui reprend à chaque cycle le même tampon du fil.
+ * Rapporte les us par cycle, avec 1 fil puis plusieurs fils, où les appels à malloc se font concurrence.
+ *
+ * Usage: banc [cycles par fil = 2000] [clefs par table = 1000] [fils = 8]
+ */
+
+#include <iostream>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+enum Mode {
+    DEFAUT, POOL, ARENE
+};
+
+/**
+ * @brief Réserve la capacité d'une table, la remplit avec toutes les clefs, puis les recherche
+ * @return Le nombre de clefs trouvées
+ */
+template<class Table, typename Clef>
+static size_t remplir(Table &table, const vector<string> &clefs, const typename Clef::allocator_type &allocateur) {
+    table.reserver(clefs.size());
+    for (size_t i = 0; i < clefs.size(); ++i) table.inserer(Clef(clefs[i], allocateur), static_cast<int>(i));
+    size_t trouvees = 0;
+    for (const string &clef: clefs) trouvees += table.contient(string_view(clef));
+    return trouvees;
+}
+
+static size_t cycles(Mode mode, const vector<string> &clefs, size_t nCycles) {
+    size_t trouvees = 0;
+    if (mode == DEFAUT) {
+        for (size_t cycle = 0; cycle < nCycles; ++cycle) {
+            TableHachage<string, int, HacheurQuadStr1> table;
+            trouvees += remplir<decltype(table), string>(table, clefs, allocator<char>());
+        }
+    } else if (mode == POOL) {
+        std::pmr::unsynchronized_pool_resource pool;
+        for (size_t cycle = 0; cycle < nCycles; ++cycle) {
+            labTableHachage::pmr::TableHachage<std::pmr::string, int, HacheurQuadStr1> table(&pool);
+            trouvees += remplir<decltype(table), std::pmr::string>(table, clefs, &pool);
+        }
+    } else {
+        vector<char> tampon(clefs.size() * 256);
+        for (size_t cycle = 0; cycle < nCycles; ++cycle) {
+            std::pmr::monotonic_buffer_resource arene(tampon.data(), tampon.size());
+            labTableHachage::pmr::TableHachage<std::pmr::string, int, HacheurQuadStr1> table(&arene);
+            trouvees += remplir<decltype(table), std::pmr::string>(table, clefs, &arene);
+        }
+    }
+    return trouvees;
+}
+
+static void mesurer(const string &nom, Mode mode, const vector<string> &clefs, size_t nCycles, size_t nFils) {
+    vector<size_t> trouvees(nFils);
+    vector<thread> fils;
+    Chrono chrono;
+    for (size_t f = 0; f < nFils; ++f) {
+        fils.push_back(thread([&, f]() { trouvees[f] = cycles(mode, clefs, nCycles); }));
+    }
+    for (thread &t: fils) t.join();
+    double us = chrono.nanosecondes() / 1e3 / nCycles;
+    size_t total = 0;
+    for (size_t n: trouvees) total += n;
+    if (total != nFils * nCycles * clefs.size()) cout << "erreur: " << total << " trouvées" << endl;
+    cout << nom << ", " << nFils << " fil(s): " << us << " us/cycle" << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t nCycles = argument(argc, argv, 1, 2000);
+    size_t n = argument(argc, argv, 2, 1000);
+    size_t nFils = argument(argc, argv, 3, 8);
+    vector<string> clefs = clefsAleatoires(n, 32);
+
+    for (size_t f: {size_t(1), nFils}) {
+        mesurer("allocateur par défaut", DEFAUT, clefs, nCycles, f);
+        mesurer("unsynchronized_pool_resource", POOL, clefs, nCycles, f);
+        mesurer("arène monotonic_buffer_resource", ARENE, clefs, nCycles, f);
+    }
+    return 0;
+}
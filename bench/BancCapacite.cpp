@@ -0,0 +1,57 @@
+/**
+ * \file BancCapacite.cpp
+ * \brief Banc d'essai des politiques de capacité: nombres premiers (modulo) contre puissances de deux (masque)
+ *
+ * Compare TableHachage avec HacheurQuadInt1 et CapacitePremiere à TableHachage avec HacheurTriangInt1 et
+ * CapacitePuissanceDeux, sur des clefs int séquentielles et aléatoires.
+ *
+ * Usage: banc [nombre de clefs = 2000000]
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+template<class Table>
+static void mesurer(const string &nom, const vector<int> &clefs) {
+    Table table;
+    Chrono chrono;
+    for (size_t i = 0; i < clefs.size(); ++i) table.inserer(clefs[i], static_cast<int>(i));
+    double nsInsertion = chrono.nanosecondes() / clefs.size();
+    long long somme = 0;
+    chrono.repartir();
+    for (int clef: clefs) somme += *table.trouver(clef);
+    double nsSucces = chrono.nanosecondes() / clefs.size();
+    chrono.repartir();
+    for (int clef: clefs) somme += table.contient(-1 - clef);
+    double nsEchec = chrono.nanosecondes() / clefs.size();
+    cout << nom << ": inserer " << nsInsertion << " ns, trouver " << nsSucces << " ns, echec " << nsEchec
+         << " ns, collisions/insertion " << table.statistiques() << " (" << somme << ")" << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t n = argument(argc, argv, 1, 2000000);
+    vector<int> sequentielles(n);
+    for (size_t i = 0; i < n; ++i) sequentielles[i] = static_cast<int>(i);
+    vector<int> aleatoires(sequentielles);
+    std::mt19937 generateur(42);
+    for (int &clef: aleatoires) clef = static_cast<int>(generateur() & 0x3fffffff);
+    std::sort(aleatoires.begin(), aleatoires.end());
+    aleatoires.erase(std::unique(aleatoires.begin(), aleatoires.end()), aleatoires.end());
+    std::shuffle(aleatoires.begin(), aleatoires.end(), generateur);
+
+    typedef TableHachage<int, int, HacheurQuadInt1, CapacitePremiere> TablePremiere;
+    typedef TableHachage<int, int, HacheurTriangInt1, CapacitePuissanceDeux> TablePuissanceDeux;
+    mesurer<TablePremiere>("sequentielles, premiere", sequentielles);
+    mesurer<TablePuissanceDeux>("sequentielles, puissance de deux", sequentielles);
+    mesurer<TablePremiere>("aleatoires, premiere", aleatoires);
+    mesurer<TablePuissanceDeux>("aleatoires, puissance de deux", aleatoires);
+    return 0;
+}
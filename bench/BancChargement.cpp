@@ -0,0 +1,67 @@
+/**
+ * \file BancChargement.cpp
+ * \brief Banc d'essai du chargement d'un lot de paires clef-valeur connu d'avance
+ *
+ * Compare trois façons de charger le même lot de paires dans une TableHachage:
+ *
+ * - la boucle d'insertions à partir de la capacité par défaut, qui rehache à chaque dépassement de TAUX_MAX;
+ * - reserver() suivi de la même boucle, sans rehachage;
+ * - le constructeur de plage, qui dimensionne la table une seule fois à partir de la longueur de la plage.
+ *
+ * Usage: banc [nombre de paires = 10000000]
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <utility>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+template<class Table>
+static void verifier(const Table &table, size_t n) {
+    if (table.taille() != static_cast<int>(n)) cout << "erreur: taille " << table.taille() << endl;
+}
+
+template<class Table, typename TypeClef>
+static void mesurer(const string &nom, const vector<pair<TypeClef, int> > &lot) {
+    {
+        Chrono chrono;
+        Table table;
+        for (const auto &paire: lot) table.inserer(paire.first, paire.second);
+        cout << nom << ", boucle: " << chrono.nanosecondes() / 1e6 << " ms, capacite " << table.capacite() << endl;
+        verifier(table, lot.size());
+    }
+    {
+        Chrono chrono;
+        Table table;
+        table.reserver(lot.size());
+        for (const auto &paire: lot) table.inserer(paire.first, paire.second);
+        cout << nom << ", reserver + boucle: " << chrono.nanosecondes() / 1e6 << " ms, capacite " << table.capacite()
+             << endl;
+        verifier(table, lot.size());
+    }
+    {
+        Chrono chrono;
+        Table table(lot.begin(), lot.end());
+        cout << nom << ", plage: " << chrono.nanosecondes() / 1e6 << " ms, capacite " << table.capacite() << endl;
+        verifier(table, lot.size());
+    }
+}
+
+int main(int argc, char **argv) {
+    size_t nEntiers = argument(argc, argv, 1, 10000000);
+    std::mt19937 generateur(42);
+
+    vector<pair<int, int> > entiers(nEntiers);
+    for (size_t i = 0; i < nEntiers; ++i) entiers[i] = make_pair(static_cast<int>(i), static_cast<int>(i));
+    std::shuffle(entiers.begin(), entiers.end(), generateur);
+    mesurer<TableHachage<int, int, HacheurQuadInt1> >("int", entiers);
+    mesurer<TableHachage<int, int, HacheurTriangInt1, CapacitePuissanceDeux> >("int, puissance de deux", entiers);
+    return 0;
+}
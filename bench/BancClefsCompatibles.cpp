@@ -0,0 +1,86 @@
+/**
+ * \file BancClefsCompatibles.cpp
+ * \brief Banc d'essai des recherches de clefs string tirées d'un tampon de lecture
+ *
+ * Les clefs de 64 caractères sont découpées dans un seul tampon, comme les champs d'une requête. Compare la recherche
+ * par une std::string temporaire construite à partir de chaque tranche et la recherche directe par std::string_view.
+ * Les allocations sont comptées en remplaçant l'opérateur new global du programme.
+ *
+ * Usage: banc [nombre de clefs = 100000] [nombre de passes = 10]
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+static std::atomic<size_t> allocations(0);
+
+void *operator new(size_t taille) {
+    ++allocations;
+    void *p = std::malloc(taille);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    std::free(p);
+}
+
+/*! HacheurQuadStr1 avec HString2 comme hash primaire, dont les séquences de sondage sont beaucoup plus courtes que
+ * celles de HString1 pour ces clefs: le coût de la clef temporaire y est moins masqué par le sondage. */
+typedef HacheurCompose<HString2, SondageQuadratique> HacheurQuadStr2;
+
+template<class Recherche>
+static void mesurer(const string &nom, const vector<string_view> &tranches, size_t nPasses, Recherche recherche) {
+    size_t avant = allocations;
+    size_t trouvees = 0;
+    Chrono chrono;
+    for (size_t passe = 0; passe < nPasses; ++passe) {
+        for (string_view tranche: tranches) trouvees += recherche(tranche);
+    }
+    double ns = chrono.nanosecondes() / static_cast<double>(nPasses * tranches.size());
+    cout << nom << ": " << ns << " ns/recherche, " << allocations - avant << " allocations" << endl;
+    if (trouvees != nPasses * tranches.size()) cout << "erreur: " << trouvees << " clefs trouvees" << endl;
+}
+
+template<class Hacheur>
+static void comparer(const string &nom, const vector<string> &clefs, const vector<string_view> &tranches,
+                     size_t nPasses) {
+    TableHachage<string, int, Hacheur> table;
+    for (size_t i = 0; i < clefs.size(); ++i) table.inserer(clefs[i], static_cast<int>(i));
+    const TableHachage<string, int, Hacheur> &t = table;
+    mesurer(nom + ", std::string temporaire", tranches, nPasses,
+            [&t](string_view tranche) { return t.contient(string(tranche)); });
+    mesurer(nom + ", std::string_view", tranches, nPasses,
+            [&t](string_view tranche) { return t.contient(tranche); });
+}
+
+int main(int argc, char **argv) {
+    size_t nClefs = argument(argc, argv, 1, 100000);
+    size_t nPasses = argument(argc, argv, 2, 10);
+    const size_t longueur = 64;
+
+    vector<string> clefs = clefsAleatoires(nClefs, longueur);
+    string tampon;
+    for (const string &clef: clefs) tampon += clef + "\n";
+    vector<string_view> tranches;
+    for (size_t i = 0; i < nClefs; ++i) tranches.push_back(string_view(tampon).substr(i * (longueur + 1), longueur));
+
+    comparer<HacheurQuadStr1>("HacheurQuadStr1", clefs, tranches, nPasses);
+    comparer<HacheurQuadStr2>("HacheurQuadStr2", clefs, tranches, nPasses);
+    return 0;
+}
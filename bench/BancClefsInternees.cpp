@@ -0,0 +1,89 @@
+/**
+ * \file BancClefsInternees.cpp
+ * \brief Banc d'essai de TableHachageChaines (clefs internées dans une arène) contre des clefs std::string
+ *
+ * Insère des clefs de 20 à 80 octets, formées comme des chemins (préfixe commun, segments, identifiant), dans
+ * TableHachage<string>, TableHachageCompacte<string> et TableHachageChaines, toutes avec HacheurQuadStr3. Rapporte la
+ * mémoire occupée par la table (mallinfo2) par entrée, les ns par insertion et par recherche d'une clef présente et
+ * d'une clef absente, dans un ordre aléatoire.
+ *
+ * Usage: banc [nombre de clefs = 1000000]
+ */
+
+#include <malloc.h>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "../TableHachage.h"
+#include "../TableHachageChaines.h"
+#include "../TableHachageCompacte.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+static size_t octetsAlloues() {
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+/**
+ * @brief Génère des clefs distinctes de 20 à 80 octets de la forme /api/<segment>/<identifiant>/<lettres>
+ */
+static vector<string> clefsChemins(size_t n, unsigned graine) {
+    const char *segments[] = {"utilisateurs", "commandes", "produits", "factures", "sessions", "paniers"};
+    mt19937_64 generateur(graine);
+    uniform_int_distribution<size_t> longueur(20, 80), segment(0, 5);
+    uniform_int_distribution<int> lettre('a', 'z');
+    vector<string> clefs;
+    clefs.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        string clef = string("/api/") + segments[segment(generateur)] + "/" + to_string(graine * n + i) + "/";
+        size_t cible = max(longueur(generateur), clef.size());
+        while (clef.size() < cible) clef.push_back(static_cast<char>(lettre(generateur)));
+        clefs.push_back(clef);
+    }
+    return clefs;
+}
+
+template<class Table>
+static void mesurer(const string &nom, const vector<string> &presentes, const vector<string> &absentes) {
+    size_t avant = octetsAlloues();
+    Table table;
+    Chrono chrono;
+    for (size_t i = 0; i < presentes.size(); ++i) table.inserer(presentes[i], static_cast<int>(i));
+    double insertion = chrono.nanosecondes() / presentes.size();
+    double octets = static_cast<double>(octetsAlloues() - avant);
+
+    vector<const string *> ordre;
+    for (const string &clef: presentes) ordre.push_back(&clef);
+    shuffle(ordre.begin(), ordre.end(), mt19937(7));
+    const Table &t = table;
+    size_t trouvees = 0;
+    chrono.repartir();
+    for (const string *clef: ordre) trouvees += t.trouver(*clef) != nullptr;
+    double succes = chrono.nanosecondes() / presentes.size();
+    chrono.repartir();
+    for (const string &clef: absentes) trouvees += t.trouver(clef) != nullptr;
+    double echec = chrono.nanosecondes() / absentes.size();
+    cout << nom << ": " << octets / presentes.size() << " o/entrée, insertion " << insertion << " ns, succès "
+         << succes << " ns, échec " << echec << " ns (" << trouvees << " trouvées)" << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t n = argument(argc, argv, 1, 1000000);
+    vector<string> presentes = clefsChemins(n, 1);
+    vector<string> absentes = clefsChemins(n, 2);
+    size_t octetsClefs = 0;
+    for (const string &clef: presentes) octetsClefs += clef.size();
+    cout << n << " clefs, " << static_cast<double>(octetsClefs) / n << " octets en moyenne" << endl;
+
+    mesurer<TableHachage<string, int, HacheurQuadStr3> >("TableHachage<string>", presentes, absentes);
+    mesurer<TableHachageCompacte<string, int, HacheurQuadStr3> >("TableHachageCompacte<string>", presentes, absentes);
+    mesurer<TableHachageChaines<int, HacheurQuadStr3> >("TableHachageChaines", presentes, absentes);
+    return 0;
+}
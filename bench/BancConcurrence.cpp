@@ -0,0 +1,89 @@
+/**
+ * \file BancConcurrence.cpp
+ * \brief Banc d'essai du débit d'une charge mixte de lectures et d'écritures selon le nombre de fils
+ *
+ * Chaque fil fait le même nombre d'opérations sur des clefs int tirées au hasard: 90 % de recherches et 10 % de
+ * insererOuAssigner. Rapporte le débit total en millions d'opérations par seconde, de 1 à 64 fils, pour une
+ * TableHachage protégée par un seul std::mutex et pour TableHachageConcurrente. Le débit ne peut pas croître au-delà
+ * du nombre de coeurs de la machine, qui est affiché.
+ *
+ * Usage: banc [opérations par fil = 1000000] [clefs = 1000000] [fils maximum = 64]
+ */
+
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../TableHachage.h"
+#include "../TableHachageConcurrente.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+/**
+ * \class TableVerrouUnique
+ * \brief TableHachage protégée par un seul verrou, comme le faisaient les utilisateurs de la table jusqu'ici
+ */
+class TableVerrouUnique {
+public:
+    explicit TableVerrouUnique(size_t n) : m_table(n) {}
+
+    bool contient(int clef) const {
+        std::lock_guard<std::mutex> verrou(m_verrou);
+        return m_table.contient(clef);
+    }
+
+    bool insererOuAssigner(int clef, int element) {
+        std::lock_guard<std::mutex> verrou(m_verrou);
+        return m_table.insererOuAssigner(clef, element);
+    }
+
+private:
+    mutable std::mutex m_verrou;
+    TableHachage<int, int, HacheurQuadInt1> m_table;
+};
+
+template<class Table>
+static double debit(Table &table, size_t nFils, size_t nOperations, int nClefs) {
+    vector<thread> fils;
+    Chrono chrono;
+    for (size_t f = 0; f < nFils; ++f) {
+        fils.push_back(thread([&table, f, nOperations, nClefs]() {
+            std::mt19937 generateur(static_cast<unsigned>(f + 1));
+            size_t trouvees = 0;
+            for (size_t i = 0; i < nOperations; ++i) {
+                int clef = static_cast<int>(generateur() % nClefs);
+                if (generateur() % 10 == 0) table.insererOuAssigner(clef, static_cast<int>(i));
+                else trouvees += table.contient(clef);
+            }
+            if (trouvees > nOperations) cout << "erreur" << endl;
+        }));
+    }
+    for (thread &t: fils) t.join();
+    return static_cast<double>(nFils * nOperations) / chrono.nanosecondes() * 1e3;
+}
+
+int main(int argc, char **argv) {
+    size_t nOperations = argument(argc, argv, 1, 1000000);
+    int nClefs = static_cast<int>(argument(argc, argv, 2, 1000000));
+    size_t maxFils = argument(argc, argv, 3, 64);
+    cout << "coeurs: " << std::thread::hardware_concurrency() << endl;
+    for (size_t nFils = 1; nFils <= maxFils; nFils *= 2) {
+        TableVerrouUnique unique(2 * nClefs);
+        TableHachageConcurrente<int, int, HacheurQuadInt1> concurrente(2 * nClefs);
+        for (int clef = 0; clef < nClefs; clef += 2) {
+            unique.insererOuAssigner(clef, clef);
+            concurrente.insererOuAssigner(clef, clef);
+        }
+        double debitUnique = debit(unique, nFils, nOperations, nClefs);
+        double debitConcurrente = debit(concurrente, nFils, nOperations, nClefs);
+        cout << nFils << " fils: verrou unique " << debitUnique << " Mops/s, segments " << debitConcurrente
+             << " Mops/s" << endl;
+    }
+    return 0;
+}
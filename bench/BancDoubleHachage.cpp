@@ -0,0 +1,74 @@
+/**
+ * \file BancDoubleHachage.cpp
+ * \brief Banc d'essai du double hachage (HacheurDouble, 80 % de remplissage) contre le sondage quadratique (50 %)
+ *
+ * Réserve puis remplit des TableHachage avec chaque hacheur, pour le même nombre de clefs int (des entiers dispersés
+ * par multiplication) et string de 12 octets, dans le tampon interne des std::string. Rapporte la capacité réservée,
+ * la mémoire occupée par la table (mesurée par mallinfo2), le nombre moyen de positions sondées par recherche d'une
+ * clef présente et d'une clef absente, et les ns par recherche.
+ *
+ * Usage: banc [nombre de clefs = 1000000]
+ */
+
+#include <malloc.h>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+static size_t _octetsAlloues() {
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+template<class Hacheur, typename TypeClef>
+static void mesurer(const string &nom, const vector<TypeClef> &clefs, const vector<TypeClef> &absentes) {
+    typedef HacheurCompteur<Hacheur> Compteur;
+    size_t avant = _octetsAlloues();
+    TableHachage<TypeClef, int, Compteur> table;
+    table.reserver(clefs.size());
+    for (size_t i = 0; i < clefs.size(); ++i) table.inserer(clefs[i], static_cast<int>(i));
+    double octets = static_cast<double>(_octetsAlloues() - avant);
+
+    size_t trouvees = 0;
+    Compteur::sondages = 0;
+    Chrono chrono;
+    for (const TypeClef &clef: clefs) trouvees += table.contient(clef);
+    double nsPresentes = chrono.nanosecondes() / clefs.size();
+    double sondagesPresentes = Compteur::sondages / static_cast<double>(clefs.size());
+    Compteur::sondages = 0;
+    chrono.repartir();
+    for (const TypeClef &clef: absentes) trouvees += table.contient(clef);
+    double nsAbsentes = chrono.nanosecondes() / absentes.size();
+    double sondagesAbsentes = Compteur::sondages / static_cast<double>(absentes.size());
+
+    cout << nom << ": capacité " << table.capacite() << ", " << octets / 1e6 << " Mo ("
+         << octets / clefs.size() << " o/clef), présentes " << sondagesPresentes << " sondages " << nsPresentes
+         << " ns, absentes " << sondagesAbsentes << " sondages " << nsAbsentes << " ns (" << trouvees << ")" << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t n = argument(argc, argv, 1, 1000000);
+    vector<int> entiers, entiersAbsents;
+    for (size_t i = 0; i < n; ++i) {
+        entiers.push_back(static_cast<int>(static_cast<uint32_t>(i) * 0x9e3779b1u));
+        entiersAbsents.push_back(static_cast<int>(static_cast<uint32_t>(n + i) * 0x9e3779b1u));
+    }
+    vector<string> clefs, absentes;
+    for (const string &clef: clefsAleatoires(2 * n, 12)) (clefs.size() < n ? clefs : absentes).push_back(clef);
+
+    mesurer<HacheurQuadInt1>("int, HacheurQuadInt1", entiers, entiersAbsents);
+    mesurer<HacheurDoubleInt1>("int, HacheurDoubleInt1", entiers, entiersAbsents);
+    mesurer<HacheurQuadStr1>("string, HacheurQuadStr1", clefs, absentes);
+    mesurer<HacheurQuadStr3>("string, HacheurQuadStr3", clefs, absentes);
+    mesurer<HacheurDoubleStr1>("string, HacheurDoubleStr1", clefs, absentes);
+    mesurer<HacheurDouble<HString3, HString2> >("string, HacheurDouble<HString3, HString2>", clefs, absentes);
+    return 0;
+}
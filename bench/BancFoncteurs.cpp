@@ -0,0 +1,84 @@
+/**
+ * \file BancFoncteurs.cpp
+ * \brief Banc d'essai des foncteurs de hachage primaires: débit et qualité de la distribution
+ *
+ * Débit: hache des clefs string de 8 à 4096 octets avec HString1, HString2 et HString3 et rapporte des Go/s, puis
+ * hache des int avec HInt1, HInt2 et HInt3 et rapporte des millions de hash par seconde.
+ *
+ * Distribution: insère des clefs semblables, des URL de même préfixe et des int multiples de 1024, dans une
+ * TableHachage pour chaque HacheurQuad*, puis rapporte le nombre moyen de collisions par insertion (statistiques())
+ * et le nombre moyen de positions sondées par recherche.
+ *
+ * Usage: banc [octets hachés par longueur = 256000000] [clefs = 200000]
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+template<class Foncteur>
+static void debitChaines(const string &nom, size_t octets) {
+    Foncteur foncteur;
+    cout << nom << ":";
+    for (size_t longueur = 8; longueur <= 4096; longueur *= 8) {
+        vector<string> clefs = clefsAleatoires(64, longueur);
+        size_t nHash = octets / longueur, total = 0;
+        Chrono chrono;
+        for (size_t i = 0; i < nHash; ++i) total += foncteur(clefs[i % clefs.size()]);
+        double ns = chrono.nanosecondes();
+        cout << " " << longueur << " o: " << (nHash * longueur) / ns << " Go/s";
+        if (total == 1) cout << "!";
+    }
+    cout << endl;
+}
+
+template<class Foncteur>
+static void debitEntiers(const string &nom, size_t nHash) {
+    Foncteur foncteur;
+    size_t total = 0;
+    Chrono chrono;
+    for (size_t i = 0; i < nHash; ++i) total += foncteur(static_cast<int>(i));
+    double ns = chrono.nanosecondes();
+    cout << nom << ": " << nHash / ns * 1e3 << " Mhash/s" << (total == 1 ? "!" : "") << endl;
+}
+
+template<class Hacheur, typename TypeClef>
+static void distribution(const string &nom, const vector<TypeClef> &clefs) {
+    typedef HacheurCompteur<Hacheur> Compteur;
+    TableHachage<TypeClef, int, Compteur> table;
+    for (size_t i = 0; i < clefs.size(); ++i) table.inserer(clefs[i], static_cast<int>(i));
+    Compteur::sondages = 0;
+    size_t trouvees = 0;
+    for (const TypeClef &clef: clefs) trouvees += table.contient(clef);
+    cout << nom << ": " << table.statistiques() << " collisions/insertion, "
+         << Compteur::sondages / static_cast<double>(trouvees) << " sondages/recherche" << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t octets = argument(argc, argv, 1, 256000000);
+    size_t nClefs = argument(argc, argv, 2, 200000);
+
+    debitChaines<HString1>("HString1", octets);
+    debitChaines<HString2>("HString2", octets);
+    debitChaines<HString3>("HString3", octets);
+    debitEntiers<HInt1>("HInt1", octets / 4);
+    debitEntiers<HInt2>("HInt2", octets / 4);
+    debitEntiers<HInt3>("HInt3", octets / 4);
+
+    vector<string> url;
+    for (size_t i = 0; i < nClefs; ++i) url.push_back("https://exemple.com/produits/" + to_string(i) + "/avis");
+    vector<int> multiples;
+    for (size_t i = 0; i < nClefs; ++i) multiples.push_back(static_cast<int>(1024 * i));
+    distribution<HacheurQuadStr1>("URL, HacheurQuadStr1", url);
+    distribution<HacheurQuadStr3>("URL, HacheurQuadStr3", url);
+    distribution<HacheurQuadInt1>("multiples de 1024, HacheurQuadInt1", multiples);
+    distribution<HacheurQuadInt3>("multiples de 1024, HacheurQuadInt3", multiples);
+    return 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * \file BancGroupes.cpp
+ * \brief Banc d'essai du sondage par groupes (TableHachageGroupes) selon le taux de remplissage
+ *
+ * Pour chaque taux de 0,5 à 0,875, remplit une table de capacité fixe et mesure le débit des insertions et des
+ * recherches infructueuses. Le sondage triangulaire sur un nombre de groupes en puissance de deux visite tous les
+ * groupes, ce qui permet ces taux. TableHachageCompacte, limitée à un taux de 0,5, sert de référence. Compiler avec
+ * -mavx2 pour le moteur AVX2, ou avec -DTABLEHACHAGE_SANS_SIMD pour le moteur portable.
+ *
+ * Usage: banc [capacité = 4000000]
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include "../TableHachageCompacte.h"
+#include "../TableHachageGroupes.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+template<class Table>
+static void mesurer(const string &nom, double taux, size_t capacite, const vector<int> &clefs) {
+    Table table(capacite);
+    size_t n = static_cast<size_t>(taux * capacite);
+    Chrono chrono;
+    for (size_t i = 0; i < n; ++i) table.inserer(clefs[i], static_cast<int>(i));
+    double debitInsertion = n / chrono.nanosecondes() * 1000;
+    size_t trouvees = 0;
+    chrono.repartir();
+    for (size_t i = 0; i < n; ++i) trouvees += table.contient(-1 - clefs[i]);
+    double debitEchec = n / chrono.nanosecondes() * 1000;
+    cout << nom << " taux " << taux << ": insertions " << debitInsertion << " M/s, recherches infructueuses "
+         << debitEchec << " M/s (" << trouvees << ")" << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t capacite = argument(argc, argv, 1, 4000000);
+#if defined(TABLEHACHAGE_AVX2)
+    cout << "moteur AVX2, groupes de " << GroupeControle::LARGEUR << endl;
+#elif defined(TABLEHACHAGE_SSE2)
+    cout << "moteur SSE2, groupes de " << GroupeControle::LARGEUR << endl;
+#else
+    cout << "moteur portable, groupes de " << GroupeControle::LARGEUR << endl;
+#endif
+    std::mt19937 generateur(42);
+    std::uniform_int_distribution<int> distribution(0, 1 << 30);
+    vector<int> clefs(capacite);
+    for (int &clef: clefs) clef = distribution(generateur);
+    std::sort(clefs.begin(), clefs.end());
+    clefs.erase(std::unique(clefs.begin(), clefs.end()), clefs.end());
+    std::shuffle(clefs.begin(), clefs.end(), generateur);
+
+    mesurer<TableHachageCompacte<int, int, HacheurQuadInt1> >("octets de controle", 0.49, 2 * capacite, clefs);
+    typedef TableHachageGroupes<int, int, HacheurTriangInt1> Groupes;
+    size_t capaciteGroupes = Groupes(capacite).capacite();
+    for (double taux: {0.5, 0.625, 0.75, 0.8, 0.875}) {
+        mesurer<Groupes>("groupes", taux, capaciteGroupes, clefs);
+    }
+    return 0;
+}
@@ -0,0 +1,53 @@
+/**
+ * \file BancHashConserve.cpp
+ * \brief Banc d'essai de la conservation du hash dans les entrées, pour de longues clefs string
+ *
+ * Les clefs ont un long préfixe commun, comme les URL d'un même site. Compare TableHachage avec HacheurQuadStr1 et
+ * avec HacheurHashConserve<HacheurQuadStr1>: insertion de toutes les clefs à partir d'une petite table (avec tous
+ * les rehachages), un rehachage explicite, puis la recherche de toutes les clefs présentes et d'autant de clefs
+ * absentes de même préfixe.
+ *
+ * Usage: banc [nombre de clefs = 100000] [longueur du préfixe = 192] [longueur du suffixe = 64]
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+template<class Hacheur>
+static void mesurer(const string &nom, const vector<string> &clefs, const vector<string> &absentes) {
+    TableHachage<string, int, Hacheur> table;
+    Chrono chronoInsertion;
+    for (size_t i = 0; i < clefs.size(); ++i) table.inserer(clefs[i], static_cast<int>(i));
+    double insertion = chronoInsertion.nanosecondes() / 1e6;
+    Chrono chronoRehachage;
+    table.rehacher();
+    double rehachage = chronoRehachage.nanosecondes() / 1e6;
+    size_t trouvees = 0;
+    Chrono chronoRecherche;
+    for (const string &clef: clefs) trouvees += table.contient(clef);
+    for (const string &clef: absentes) trouvees += table.contient(clef);
+    double recherche = chronoRecherche.nanosecondes() / 1e6;
+    cout << nom << ": insertion " << insertion << " ms, rehacher " << rehachage << " ms, recherches " << recherche
+         << " ms (" << trouvees << " trouvées)" << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t n = argument(argc, argv, 1, 100000);
+    string prefixe(argument(argc, argv, 2, 192), '/');
+    size_t suffixe = argument(argc, argv, 3, 64);
+    vector<string> clefs, absentes;
+    for (const string &clef: clefsAleatoires(2 * n, suffixe)) {
+        (clefs.size() < n ? clefs : absentes).push_back(prefixe + clef);
+    }
+    mesurer<HacheurQuadStr1>("HacheurQuadStr1", clefs, absentes);
+    mesurer<HacheurHashConserve<HacheurQuadStr1> >("HacheurHashConserve", clefs, absentes);
+    return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * \file BancLatenceQueue.cpp
+ * \brief Banc d'essai de la latence de queue des recherches: Robin Hood contre sondage quadratique
+ *
+ * Mesure individuellement chaque recherche réussie et chaque recherche infructueuse et rapporte les centiles p50,
+ * p99 et p999 en nanosecondes, pour TableHachageRobinHood et TableHachage. Le coût de la mesure elle-même (quelques
+ * dizaines de ns) est inclus dans tous les centiles.
+ *
+ * Usage: banc [nombre de clefs int = 1000000] [nombre de clefs string = 100000]
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include "../TableHachage.h"
+#include "../TableHachageRobinHood.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+static void rapporter(const string &nom, vector<double> &latences) {
+    std::sort(latences.begin(), latences.end());
+    size_t n = latences.size();
+    cout << nom << ": p50 " << latences[n / 2] << " ns, p99 " << latences[n * 99 / 100] << " ns, p999 "
+         << latences[n * 999 / 1000] << " ns, max " << latences.back() << " ns" << endl;
+}
+
+template<class Table, typename TypeClef>
+static void mesurer(const string &nom, const vector<TypeClef> &presentes, const vector<TypeClef> &absentes) {
+    Table table;
+    for (size_t i = 0; i < presentes.size(); ++i) table.inserer(presentes[i], static_cast<int>(i));
+    const Table &t = table;
+    vector<double> latences;
+    latences.reserve(presentes.size());
+    size_t trouvees = 0;
+    for (const TypeClef &clef: presentes) {
+        Chrono chrono;
+        trouvees += t.trouver(clef) != nullptr;
+        latences.push_back(chrono.nanosecondes());
+    }
+    rapporter(nom + ", succes", latences);
+    latences.clear();
+    for (const TypeClef &clef: absentes) {
+        Chrono chrono;
+        trouvees += t.trouver(clef) != nullptr;
+        latences.push_back(chrono.nanosecondes());
+    }
+    rapporter(nom + ", echec", latences);
+    if (trouvees != presentes.size()) cout << "erreur: " << trouvees << " clefs trouvees" << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t nEntiers = argument(argc, argv, 1, 1000000);
+    size_t nChaines = argument(argc, argv, 2, 100000);
+    std::mt19937 generateur(42);
+
+    vector<int> entiers(2 * nEntiers);
+    for (int &clef: entiers) clef = static_cast<int>(generateur() & 0x3fffffff);
+    std::sort(entiers.begin(), entiers.end());
+    entiers.erase(std::unique(entiers.begin(), entiers.end()), entiers.end());
+    std::shuffle(entiers.begin(), entiers.end(), generateur);
+    vector<int> entiersPresents(entiers.begin(), entiers.begin() + nEntiers);
+    vector<int> entiersAbsents(entiers.begin() + nEntiers, entiers.end());
+    mesurer<TableHachage<int, int, HacheurQuadInt1> >("int, quadratique", entiersPresents, entiersAbsents);
+    mesurer<TableHachageRobinHood<int, int, HacheurQuadInt1> >("int, Robin Hood", entiersPresents, entiersAbsents);
+
+    vector<string> chaines = clefsAleatoires(2 * nChaines, 24);
+    std::shuffle(chaines.begin(), chaines.end(), generateur);
+    vector<string> chainesPresentes(chaines.begin(), chaines.begin() + nChaines);
+    vector<string> chainesAbsentes(chaines.begin() + nChaines, chaines.end());
+    mesurer<TableHachage<string, int, HacheurQuadStr1> >("string, quadratique", chainesPresentes, chainesAbsentes);
+    mesurer<TableHachageRobinHood<string, int, HacheurQuadStr1> >("string, Robin Hood", chainesPresentes,
+                                                                  chainesAbsentes);
+    return 0;
+}
@@ -0,0 +1,75 @@
+/**
+ * \file BancLectureOptimiste.cpp
+ * \brief Banc d'essai du débit des lectures selon le nombre de fils, pendant qu'un fil modifie la table
+ *
+ * Chaque fil lecteur fait le même nombre de recherches de clefs int tirées au hasard, pendant qu'un fil rédacteur
+ * remplace des valeurs en boucle jusqu'à la fin des lectures. Rapporte le débit total des lectures en millions de
+ * recherches par seconde, de 1 à 64 fils lecteurs, pour TableHachageConcurrente, dont les lectures prennent le verrou
+ * partagé de leur segment, et pour TableHachageLectureOptimiste, dont les lectures ne prennent aucun verrou. Le débit
+ * ne peut pas croître au-delà du nombre de coeurs de la machine, qui est affiché.
+ *
+ * Usage: banc [recherches par fil = 1000000] [clefs = 1000000] [fils maximum = 64]
+ */
+
+#include <atomic>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+#include "../TableHachageConcurrente.h"
+#include "../TableHachageLectureOptimiste.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+template<class Table>
+static double debitLectures(Table &table, size_t nFils, size_t nRecherches, int nClefs) {
+    std::atomic<bool> fini(false);
+    thread redacteur([&table, &fini, nClefs]() {
+        std::mt19937 generateur(0);
+        for (int i = 0; !fini.load(std::memory_order_relaxed); ++i) {
+            table.insererOuAssigner(static_cast<int>(generateur() % nClefs) & ~1, i);
+            if (i % 64 == 0) std::this_thread::yield();
+        }
+    });
+    vector<thread> fils;
+    Chrono chrono;
+    for (size_t f = 0; f < nFils; ++f) {
+        fils.push_back(thread([&table, f, nRecherches, nClefs]() {
+            std::mt19937 generateur(static_cast<unsigned>(f + 1));
+            size_t trouvees = 0;
+            for (size_t i = 0; i < nRecherches; ++i) {
+                trouvees += table.contient(static_cast<int>(generateur() % nClefs));
+            }
+            if (trouvees > nRecherches) cout << "erreur" << endl;
+        }));
+    }
+    for (thread &t: fils) t.join();
+    double debit = static_cast<double>(nFils * nRecherches) / chrono.nanosecondes() * 1e3;
+    fini.store(true);
+    redacteur.join();
+    return debit;
+}
+
+int main(int argc, char **argv) {
+    size_t nRecherches = argument(argc, argv, 1, 1000000);
+    int nClefs = static_cast<int>(argument(argc, argv, 2, 1000000));
+    size_t maxFils = argument(argc, argv, 3, 64);
+    cout << "coeurs: " << std::thread::hardware_concurrency() << endl;
+    for (size_t nFils = 1; nFils <= maxFils; nFils *= 2) {
+        TableHachageConcurrente<int, int, HacheurQuadInt1> concurrente(2 * nClefs);
+        TableHachageLectureOptimiste<int, int, HacheurQuadInt1> optimiste(2 * nClefs);
+        for (int clef = 0; clef < nClefs; clef += 2) {
+            concurrente.insererOuAssigner(clef, clef);
+            optimiste.insererOuAssigner(clef, clef);
+        }
+        double debitConcurrente = debitLectures(concurrente, nFils, nRecherches, nClefs);
+        double debitOptimiste = debitLectures(optimiste, nFils, nRecherches, nClefs);
+        cout << nFils << " fils: segments " << debitConcurrente << " Mrech/s, sans verrou " << debitOptimiste
+             << " Mrech/s" << endl;
+    }
+    return 0;
+}
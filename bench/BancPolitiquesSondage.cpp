@@ -0,0 +1,86 @@
+/**
+ * \file BancPolitiquesSondage.cpp
+ * \brief Banc d'essai des politiques de sondage composées par HacheurCompose et du sondage incrémental
+ *
+ * Pour des clefs string de même préfixe et des clefs int, compare dans TableHachage chaque composition (sondage
+ * quadratique avec capacité première, triangulaire ou linéaire avec capacité en puissance de deux) à la même
+ * composition réduite à l'opérateur (clef, i), qui rehache la clef à chaque tentative comme les anciens HacheurQuad*.
+ * Rapporte les ns par insertion et par recherche (moitié présentes, moitié absentes).
+ *
+ * Usage: banc [nombre de clefs = 500000] [longueur des clefs = 64]
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+/**
+ * \class HacheurRecalcule
+ * \brief N'offre d'un hacheur que son opérateur (clef, i): TableHachage hache alors la clef à chaque tentative
+ */
+template<class Hacheur>
+class HacheurRecalcule {
+public:
+    typedef typename Hacheur::Capacite Capacite;
+
+    HacheurRecalcule(size_t p_tailleTable) : m_hacheur(p_tailleTable) {}
+
+    template<typename TypeClef>
+    size_t operator()(const TypeClef &p_clef, size_t p_tentative = 0) const {
+        return m_hacheur(p_clef, p_tentative);
+    }
+
+private:
+    Hacheur m_hacheur;
+};
+
+template<class Hacheur, class PolitiqueCapacite, typename TypeClef>
+static void mesurer(const string &nom, const vector<TypeClef> &clefs, const vector<TypeClef> &absentes) {
+    TableHachage<TypeClef, int, Hacheur, PolitiqueCapacite> table;
+    Chrono chrono;
+    for (size_t i = 0; i < clefs.size(); ++i) table.inserer(clefs[i], static_cast<int>(i));
+    double insertion = chrono.nanosecondes() / clefs.size();
+    size_t trouvees = 0;
+    chrono.repartir();
+    for (size_t i = 0; i < clefs.size(); ++i) trouvees += table.contient(clefs[i]) + table.contient(absentes[i]);
+    double recherche = chrono.nanosecondes() / (2 * clefs.size());
+    cout << nom << ": insertion " << insertion << " ns, recherche " << recherche << " ns (" << trouvees
+         << " trouvées, " << table.statistiques() << " collisions/insertion)" << endl;
+}
+
+template<class HashPrimaire, class PolitiqueSondage, class PolitiqueCapacite, typename TypeClef>
+static void comparer(const string &nom, const vector<TypeClef> &clefs, const vector<TypeClef> &absentes) {
+    typedef HacheurCompose<HashPrimaire, PolitiqueSondage, PolitiqueCapacite> Hacheur;
+    mesurer<HacheurRecalcule<Hacheur>, PolitiqueCapacite>(nom + ", rehachée à chaque tentative", clefs, absentes);
+    mesurer<Hacheur, PolitiqueCapacite>(nom + ", incrémental", clefs, absentes);
+}
+
+int main(int argc, char **argv) {
+    size_t n = argument(argc, argv, 1, 500000);
+    size_t longueur = argument(argc, argv, 2, 64);
+    vector<string> clefs, absentes;
+    for (const string &clef: clefsAleatoires(2 * n, longueur / 2)) {
+        (clefs.size() < n ? clefs : absentes).push_back(string(longueur - longueur / 2, '/') + clef);
+    }
+    vector<int> entiers, entiersAbsents;
+    for (size_t i = 0; i < n; ++i) {
+        entiers.push_back(static_cast<int>(2 * i));
+        entiersAbsents.push_back(static_cast<int>(2 * i + 1));
+    }
+
+    comparer<HString1, SondageQuadratique, CapacitePremiere>("string, HString1 quadratique", clefs, absentes);
+    comparer<HString3, SondageQuadratique, CapacitePremiere>("string, HString3 quadratique", clefs, absentes);
+    comparer<HString3, SondageTriangulaire, CapacitePuissanceDeux>("string, HString3 triangulaire", clefs, absentes);
+    comparer<HString3, SondageLineaire, CapacitePuissanceDeux>("string, HString3 linéaire", clefs, absentes);
+    comparer<HInt1, SondageQuadratique, CapacitePremiere>("int, HInt1 quadratique", entiers, entiersAbsents);
+    comparer<HInt3, SondageTriangulaire, CapacitePuissanceDeux>("int, HInt3 triangulaire", entiers, entiersAbsents);
+    comparer<HInt3, SondageLineaire, CapacitePuissanceDeux>("int, HInt3 linéaire", entiers, entiersAbsents);
+    return 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * \file BancProjection.cpp
+ * \brief Banc d'essai du démarrage d'une TableHachageProjetee contre la reconstruction d'une TableHachage
+ *
+ * Pour des clefs int dispersées et des clefs string de 32 octets: reconstruit une TableHachage par inserer à partir
+ * des paires source, comme au démarrage d'un processus, la sauvegarde, puis ouvre le fichier par mmap avec et sans
+ * vérification de la somme de contrôle. Rapporte les ms de chaque étape, le temps des 1000 premières recherches
+ * après l'ouverture et les ns par recherche des deux tables. Le fichier vient d'être écrit: il est dans le cache de
+ * pages, comme au redémarrage d'un service sur la même machine.
+ *
+ * Usage: banc [nombre de clefs = 1000000]
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../TableHachage.h"
+#include "../TableHachageProjetee.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+template<class Table, typename TypeClef>
+static double rechercher(const Table &table, const vector<TypeClef> &clefs, size_t n, size_t &trouvees) {
+    Chrono chrono;
+    for (size_t i = 0; i < n; ++i) trouvees += table.trouver(clefs[i]) != nullptr;
+    return chrono.nanosecondes();
+}
+
+template<typename TypeClef, class Hacheur>
+static void mesurer(const string &nom, const vector<TypeClef> &clefs, const string &fichier) {
+    Chrono chrono;
+    TableHachage<TypeClef, int, Hacheur> table;
+    for (size_t i = 0; i < clefs.size(); ++i) table.inserer(clefs[i], static_cast<int>(i));
+    double reconstruction = chrono.nanosecondes() / 1e6;
+    chrono.repartir();
+    TableHachageProjetee<TypeClef, int, Hacheur>::sauvegarder(table, fichier);
+    double sauvegarde = chrono.nanosecondes() / 1e6;
+    size_t octets = std::filesystem::file_size(fichier);
+
+    size_t trouvees = 0;
+    chrono.repartir();
+    TableHachageProjetee<TypeClef, int, Hacheur> nonVerifiee(fichier, false);
+    double ouverture = chrono.nanosecondes() / 1e6;
+    double premieres = rechercher(nonVerifiee, clefs, 1000, trouvees) / 1e3;
+    chrono.repartir();
+    TableHachageProjetee<TypeClef, int, Hacheur> verifiee(fichier);
+    double verification = chrono.nanosecondes() / 1e6;
+
+    double nsTable = rechercher(table, clefs, clefs.size(), trouvees) / clefs.size();
+    double nsProjetee = rechercher(verifiee, clefs, clefs.size(), trouvees) / clefs.size();
+    cout << nom << ": reconstruction par inserer " << reconstruction << " ms, sauvegarde " << sauvegarde << " ms ("
+         << octets / 1e6 << " Mo), ouverture " << ouverture << " ms, ouverture vérifiée " << verification
+         << " ms, 1000 premières recherches " << premieres << " us, recherche " << nsTable << " ns contre "
+         << nsProjetee << " ns (" << trouvees << ")" << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t n = argument(argc, argv, 1, 1000000);
+    string fichier = (std::filesystem::temp_directory_path() / "BancProjection.tbl").string();
+
+    vector<int> entiers;
+    for (size_t i = 0; i < n; ++i) entiers.push_back(static_cast<int>(static_cast<uint32_t>(i) * 0x9e3779b1u));
+    mesurer<int, HacheurQuadInt1>("int, HacheurQuadInt1", entiers, fichier);
+    mesurer<string, HacheurQuadStr3>("string, HacheurQuadStr3", clefsAleatoires(n, 32), fichier);
+    remove(fichier.c_str());
+    return 0;
+}
@@ -0,0 +1,56 @@
+/**
+ * \file BancRechercheParLot.cpp
+ * \brief Banc d'essai des recherches par lot avec préchargement, comparées à une boucle de contient
+ *
+ * Remplit une TableHachage de n clefs int, beaucoup plus grande que le cache de dernier niveau, puis cherche des lots
+ * de clefs tirées au hasard, dont la moitié sont absentes. Pour chaque taille de lot de 8 à 1024, rapporte le temps
+ * moyen par recherche d'une boucle de contient et de contientLot.
+ *
+ * Usage: banc [clefs = 32000000] [recherches = 4000000]
+ */
+
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+int main(int argc, char **argv) {
+    size_t nClefs = argument(argc, argv, 1, 32000000);
+    size_t nRecherches = argument(argc, argv, 2, 4000000);
+    TableHachage<int, int, HacheurQuadInt1> table;
+    table.reserver(nClefs);
+    for (size_t i = 0; i < nClefs; ++i) table.inserer(static_cast<int>(2 * i), static_cast<int>(i));
+    cout << "capacité: " << table.capacite() << " entrées" << endl;
+
+    std::mt19937 generateur(42);
+    vector<int> clefs(nRecherches);
+    for (int &clef: clefs) clef = static_cast<int>(generateur() % (2 * nClefs));
+    unique_ptr<bool[]> presents(new bool[nRecherches]);
+
+    for (size_t taille = 8; taille <= 1024; taille *= 2) {
+        size_t nLots = nRecherches / taille;
+        size_t trouvees = 0;
+        Chrono chronoBoucle;
+        for (size_t lot = 0; lot < nLots; ++lot) {
+            for (size_t i = lot * taille; i < (lot + 1) * taille; ++i) presents[i] = table.contient(clefs[i]);
+            trouvees += presents[lot * taille];
+        }
+        double boucle = chronoBoucle.nanosecondes() / (nLots * taille);
+        Chrono chronoLot;
+        for (size_t lot = 0; lot < nLots; ++lot) {
+            table.contientLot(&clefs[lot * taille], taille, &presents[lot * taille]);
+            trouvees += presents[lot * taille];
+        }
+        double parLot = chronoLot.nanosecondes() / (nLots * taille);
+        cout << "lots de " << taille << ": boucle " << boucle << " ns/recherche, contientLot " << parLot
+             << " ns/recherche (" << trouvees << ")" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,59 @@
+/**
+ * \file BancRehachageIncremental.cpp
+ * \brief Banc d'essai de la latence des insertions: rehachage complet contre rehachage incrémental
+ *
+ * Insère les clefs une à une dans une table qui part de la capacité par défaut, en mesurant chaque insertion, et
+ * rapporte les centiles p50, p99 et p999, la latence maximale et le temps total, pour TableHachage (rehachage complet
+ * lors de l'insertion qui dépasse TAUX_MAX) et TableHachageIncrementale (migration étalée sur les opérations
+ * suivantes). La latence maximale de TableHachageIncrementale comprend encore l'allocation de la nouvelle table.
+ *
+ * Usage: banc [nombre de clefs int = 4000000] [nombre de clefs string = 200000]
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include "../TableHachage.h"
+#include "../TableHachageIncrementale.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+template<class Table, typename TypeClef>
+static void mesurer(const string &nom, const vector<TypeClef> &clefs) {
+    Table table;
+    vector<double> latences;
+    latences.reserve(clefs.size());
+    Chrono total;
+    for (size_t i = 0; i < clefs.size(); ++i) {
+        Chrono chrono;
+        table.inserer(clefs[i], static_cast<int>(i));
+        latences.push_back(chrono.nanosecondes());
+    }
+    double ms = total.nanosecondes() / 1e6;
+    std::sort(latences.begin(), latences.end());
+    size_t n = latences.size();
+    cout << nom << ": p50 " << latences[n / 2] << " ns, p99 " << latences[n * 99 / 100] << " ns, p999 "
+         << latences[n * 999 / 1000] << " ns, max " << latences.back() / 1e3 << " us, total " << ms << " ms" << endl;
+    if (table.taille() != static_cast<int>(n)) cout << "erreur: taille " << table.taille() << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t nEntiers = argument(argc, argv, 1, 4000000);
+    size_t nChaines = argument(argc, argv, 2, 200000);
+    std::mt19937 generateur(42);
+
+    vector<int> entiers(nEntiers);
+    for (size_t i = 0; i < nEntiers; ++i) entiers[i] = static_cast<int>(i);
+    std::shuffle(entiers.begin(), entiers.end(), generateur);
+    mesurer<TableHachage<int, int, HacheurQuadInt1> >("int, complet", entiers);
+    mesurer<TableHachageIncrementale<int, int, HacheurQuadInt1> >("int, incremental", entiers);
+
+    vector<string> chaines = clefsAleatoires(nChaines, 24);
+    mesurer<TableHachage<string, int, HacheurQuadStr1> >("string, complet", chaines);
+    mesurer<TableHachageIncrementale<string, int, HacheurQuadStr1> >("string, incremental", chaines);
+    return 0;
+}
@@ -0,0 +1,40 @@
+/**
+ * \file BancRehachageParallele.cpp
+ * \brief Banc d'essai du temps d'un rehachage selon le nombre de fils qui se le partagent
+ *
+ * Remplit une TableHachage de n clefs int, puis mesure un appel à rehacher pour 1, 2, 4... fils. Rapporte le temps
+ * de chaque rehachage et l'accélération par rapport au rehachage séquentiel. L'accélération ne peut pas dépasser le
+ * nombre de coeurs de la machine, qui est affiché.
+ *
+ * Usage: banc [clefs = 4000000] [fils maximum = 16]
+ */
+
+#include <iostream>
+#include <thread>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+int main(int argc, char **argv) {
+    size_t nClefs = argument(argc, argv, 1, 4000000);
+    size_t maxFils = argument(argc, argv, 2, 16);
+    cout << "coeurs: " << std::thread::hardware_concurrency() << endl;
+    double sequentiel = 0;
+    for (size_t nFils = 1; nFils <= maxFils; nFils *= 2) {
+        TableHachage<int, int, HacheurQuadInt1> table;
+        table.reserver(nClefs);
+        for (size_t i = 0; i < nClefs; ++i) table.inserer(static_cast<int>(i * 7919), static_cast<int>(i));
+        table.asgFilsRehachage(nFils);
+        Chrono chrono;
+        table.rehacher();
+        double ms = chrono.nanosecondes() / 1e6;
+        if (nFils == 1) sequentiel = ms;
+        cout << nFils << " fils: " << ms << " ms, accélération " << sequentiel / ms << " (capacité "
+             << table.capacite() << ")" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * \file BancRoulement.cpp
+ * \brief Banc d'essai en régime permanent d'insertions et de retraits (cache de sessions)
+ *
+ * Garde un nombre fixe de clefs vivantes dans la table: chaque paire d'opérations retire une clef vivante au hasard
+ * et insère une nouvelle clef. Rapporte le temps par opération pour chaque tranche du roulement, et:
+ *
+ * - pour TableHachageLineaire, la longueur moyenne des séquences de sondage, qui doit rester constante puisque le
+ *   retrait ne laisse pas d'entrée effacée;
+ * - pour TableHachage, le nombre d'entrées effacées et de compactages, à capacité constante.
+ *
+ * Usage: banc [nombre d'opérations = 100000000] [clefs vivantes = 1000000]
+ */
+
+#include <iostream>
+#include <string>
+#include "../TableHachage.h"
+#include "../TableHachageLineaire.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+static void decrire(const TableHachageLineaire<int, int, HacheurQuadInt1> &table) {
+    cout << "sondage moyen " << table.longueurSondageMoyenne();
+}
+
+static void decrire(const TableHachage<int, int, HacheurQuadInt1> &table) {
+    cout << "effaces " << table.nombreEffaces() << ", compactages " << table.nombreCompactages() << ", capacite "
+         << table.capacite();
+}
+
+template<class Table>
+static void rouler(const string &nom, size_t nOperations, size_t nVivantes) {
+    const size_t nTranches = 10;
+    Table table;
+    std::mt19937_64 generateur(42);
+    vector<int> vivantes(nVivantes);
+    int prochaineClef = 0;
+    for (size_t i = 0; i < nVivantes; ++i) {
+        vivantes[i] = static_cast<int>(generateur() & 0x3fffffff);
+        while (table.contient(vivantes[i])) vivantes[i] = static_cast<int>(generateur() & 0x3fffffff);
+        table.inserer(vivantes[i], prochaineClef++);
+    }
+    cout << nom << ", depart: ";
+    decrire(table);
+    cout << endl;
+
+    for (size_t tranche = 1; tranche <= nTranches; ++tranche) {
+        Chrono chrono;
+        for (size_t operation = 0; operation < nOperations / nTranches; operation += 2) {
+            size_t victime = generateur() % nVivantes;
+            table.enlever(vivantes[victime]);
+            int clef = static_cast<int>(generateur() & 0x3fffffff);
+            while (table.contient(clef)) clef = static_cast<int>(generateur() & 0x3fffffff);
+            table.inserer(clef, prochaineClef++);
+            vivantes[victime] = clef;
+        }
+        double ns = chrono.nanosecondes() / (nOperations / nTranches);
+        cout << nom << ", tranche " << tranche << ": " << ns << " ns/op, taille " << table.taille() << ", ";
+        decrire(table);
+        cout << endl;
+    }
+}
+
+int main(int argc, char **argv) {
+    size_t nOperations = argument(argc, argv, 1, 100000000);
+    size_t nVivantes = argument(argc, argv, 2, 1000000);
+    rouler<TableHachageLineaire<int, int, HacheurQuadInt1> >("lineaire", nOperations, nVivantes);
+    rouler<TableHachage<int, int, HacheurQuadInt1> >("quadratique", nOperations, nVivantes);
+    return 0;
+}
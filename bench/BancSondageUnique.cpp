@@ -0,0 +1,65 @@
+/**
+ * \file BancSondageUnique.cpp
+ * \brief Banc d'essai de l'API à sondage unique (trouver, insererSiAbsent, insererOuAssigner)
+ *
+ * Compare, sur des clefs string et HacheurQuadStr1, le patron d'appel avec contient suivi de inserer ou element
+ * (deux séquences de sondage) aux appels à sondage unique. Rapporte le nombre de positions sondées et les ns par
+ * opération.
+ *
+ * Usage: banc [nombre de clefs = 1000000]
+ */
+
+#include <iostream>
+#include <string>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+typedef HacheurCompteur<HacheurQuadStr1> Compteur;
+typedef TableHachage<string, double, Compteur> TableT;
+
+static void rapporter(const string &nom, double ns, size_t operations) {
+    cout << nom << ": " << Compteur::sondages / static_cast<double>(operations) << " sondages/op, "
+         << ns / operations << " ns/op" << endl;
+    Compteur::sondages = 0;
+}
+
+int main(int argc, char **argv) {
+    size_t n = argument(argc, argv, 1, 1000000);
+    vector<string> clefs = clefsAleatoires(n, 16);
+    double somme = 0;
+
+    {
+        TableT table;
+        Compteur::sondages = 0;
+        Chrono chrono;
+        for (size_t i = 0; i < n; ++i) {
+            if (!table.contient(clefs[i])) table.inserer(clefs[i], i);
+        }
+        rapporter("avant, contient + inserer", chrono.nanosecondes(), n);
+        chrono.repartir();
+        for (size_t i = 0; i < n; ++i) {
+            if (table.contient(clefs[i])) somme += table.element(clefs[i]);
+        }
+        rapporter("avant, contient + element", chrono.nanosecondes(), n);
+    }
+    {
+        TableT table;
+        Compteur::sondages = 0;
+        Chrono chrono;
+        for (size_t i = 0; i < n; ++i) table.insererSiAbsent(clefs[i], i);
+        rapporter("apres, insererSiAbsent", chrono.nanosecondes(), n);
+        chrono.repartir();
+        for (size_t i = 0; i < n; ++i) {
+            const double *valeur = static_cast<const TableT &>(table).trouver(clefs[i]);
+            if (valeur) somme += *valeur;
+        }
+        rapporter("apres, trouver", chrono.nanosecondes(), n);
+    }
+    cout << "(somme de controle " << somme << ")" << endl;
+    return 0;
+}
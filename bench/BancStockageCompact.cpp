@@ -0,0 +1,62 @@
+/**
+ * \file BancStockageCompact.cpp
+ * \brief Banc d'essai de TableHachageCompacte (octets de contrôle séparés) contre TableHachage (tableau d'entrées)
+ *
+ * Rapporte la latence moyenne des recherches réussies et des recherches infructueuses, pour des clefs int et
+ * string. Les clefs string sont dix fois moins nombreuses, HString1 produisant de longues chaînes de collisions.
+ *
+ * Usage: banc [nombre de clefs = 1000000]
+ */
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include "../TableHachage.h"
+#include "../TableHachageCompacte.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+template<class Table, typename TypeClef>
+static void mesurer(const string &nom, const vector<TypeClef> &presentes, const vector<TypeClef> &absentes) {
+    Table table;
+    for (size_t i = 0; i < presentes.size(); ++i) table.inserer(presentes[i], i);
+    const Table &t = table;
+    size_t trouvees = 0;
+    Chrono chrono;
+    for (const TypeClef &clef: presentes) trouvees += t.trouver(clef) != nullptr;
+    double nsSucces = chrono.nanosecondes() / presentes.size();
+    chrono.repartir();
+    for (const TypeClef &clef: absentes) trouvees += t.trouver(clef) != nullptr;
+    double nsEchec = chrono.nanosecondes() / absentes.size();
+    cout << nom << ": succes " << nsSucces << " ns, echec " << nsEchec << " ns (" << trouvees << " trouvees)"
+         << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t n = argument(argc, argv, 1, 1000000);
+
+    vector<int> entiers(2 * n);
+    std::mt19937 generateur(42);
+    for (size_t i = 0; i < entiers.size(); ++i) entiers[i] = static_cast<int>(i);
+    std::shuffle(entiers.begin(), entiers.end(), generateur);
+    vector<int> entiersPresents(entiers.begin(), entiers.begin() + n);
+    vector<int> entiersAbsents(entiers.begin() + n, entiers.end());
+    mesurer<TableHachage<int, double, HacheurQuadInt1> >("int, tableau d'entrees", entiersPresents, entiersAbsents);
+    mesurer<TableHachageCompacte<int, double, HacheurQuadInt1> >("int, octets de controle", entiersPresents,
+                                                                  entiersAbsents);
+
+    size_t nChaines = n / 10;
+    vector<string> chaines = clefsAleatoires(2 * nChaines, 24);
+    std::shuffle(chaines.begin(), chaines.end(), generateur);
+    vector<string> chainesPresentes(chaines.begin(), chaines.begin() + nChaines);
+    vector<string> chainesAbsentes(chaines.begin() + nChaines, chaines.end());
+    mesurer<TableHachage<string, double, HacheurQuadStr1> >("string, tableau d'entrees", chainesPresentes,
+                                                            chainesAbsentes);
+    mesurer<TableHachageCompacte<string, double, HacheurQuadStr1> >("string, octets de controle", chainesPresentes,
+                                                                     chainesAbsentes);
+    return 0;
+}
@@ -0,0 +1,84 @@
+/**
+ * \file BancTauxRemplissage.cpp
+ * \brief Banc d'essai des réglages par table: taux maximum, facteur d'agrandissement et réduction automatique
+ *
+ * Trois mesures sur des clefs int dispersées, avec la mémoire occupée par la table (mallinfo2):
+ *
+ * - taux maximum: remplit une table par insertions successives pour chaque taux, avec HacheurQuadInt1 et
+ *   HacheurDoubleInt1, et rapporte la mémoire, les ns par insertion et par recherche;
+ * - facteur d'agrandissement: même remplissage pour chaque facteur, avec la mémoire finale et le temps d'insertion;
+ * - rafale: remplit la table, retire 98 % des clefs, puis rapporte la mémoire et le temps d'un parcours complet de
+ *   la table, sans réduction, avec un taux minimum de 10 % et après ajusterCapacite.
+ *
+ * Usage: banc [nombre de clefs = 2000000]
+ */
+
+#include <malloc.h>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+static size_t octetsAlloues() {
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+template<class Hacheur>
+static void mesurerTaux(const string &nom, int taux, double facteur, const vector<int> &clefs) {
+    size_t avant = octetsAlloues();
+    TableHachage<int, int, Hacheur> table;
+    table.asgTauxMax(taux);
+    table.asgFacteurCroissance(facteur);
+    Chrono chrono;
+    for (size_t i = 0; i < clefs.size(); ++i) table.inserer(clefs[i], static_cast<int>(i));
+    double insertion = chrono.nanosecondes() / clefs.size();
+    double octets = static_cast<double>(octetsAlloues() - avant);
+    size_t trouvees = 0;
+    chrono.repartir();
+    for (int clef: clefs) trouvees += table.contient(clef) + table.contient(clef + 1);
+    double recherche = chrono.nanosecondes() / (2 * clefs.size());
+    cout << nom << ", taux " << taux << " %, facteur " << facteur << ": " << octets / 1e6 << " Mo, insertion "
+         << insertion << " ns, recherche " << recherche << " ns (" << trouvees << ")" << endl;
+}
+
+static void mesurerRafale(const string &nom, int tauxMin, bool ajuster, const vector<int> &clefs) {
+    size_t avant = octetsAlloues();
+    TableHachage<int, int, HacheurQuadInt1> table;
+    table.asgTauxMin(tauxMin);
+    for (size_t i = 0; i < clefs.size(); ++i) table.inserer(clefs[i], static_cast<int>(i));
+    size_t retraits = clefs.size() - clefs.size() / 50;
+    Chrono chrono;
+    for (size_t i = 0; i < retraits; ++i) table.enlever(clefs[i]);
+    double retrait = chrono.nanosecondes() / retraits;
+    if (ajuster) table.ajusterCapacite();
+    double octets = static_cast<double>(octetsAlloues() - avant);
+    long long somme = 0;
+    chrono.repartir();
+    for (auto paire: table) somme += paire.second;
+    double parcours = chrono.nanosecondes() / 1e3;
+    cout << nom << ": capacité " << table.capacite() << ", " << octets / 1e6 << " Mo, retrait " << retrait
+         << " ns, parcours " << parcours << " us (" << somme << ")" << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t n = argument(argc, argv, 1, 2000000);
+    vector<int> clefs;
+    for (size_t i = 0; i < n; ++i) clefs.push_back(static_cast<int>(static_cast<uint32_t>(2 * i) * 0x9e3779b1u));
+
+    for (int taux: {25, 35, 50}) mesurerTaux<HacheurQuadInt1>("HacheurQuadInt1", taux, 2, clefs);
+    for (int taux: {50, 65, 80}) mesurerTaux<HacheurDoubleInt1>("HacheurDoubleInt1", taux, 2, clefs);
+    for (double facteur: {1.25, 1.5, 2.0, 3.0}) mesurerTaux<HacheurQuadInt1>("HacheurQuadInt1", 50, facteur, clefs);
+
+    mesurerRafale("rafale, sans réduction", 0, false, clefs);
+    mesurerRafale("rafale, taux minimum 10 %", 10, false, clefs);
+    mesurerRafale("rafale, ajusterCapacite", 0, true, clefs);
+    return 0;
+}
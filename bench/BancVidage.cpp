@@ -0,0 +1,70 @@
+/**
+ * \file BancVidage.cpp
+ * \brief Banc d'essai de vider() en temps constant (HacheurViderParGeneration) sur de grandes tables peu remplies
+ *
+ * Réserve une grande TableHachage, puis répète des cycles vider() suivi de l'insertion et de la recherche de quelques
+ * clefs, comme une table de travail réutilisée à chaque requête. Rapporte les ns par cycle avec HacheurQuadInt1 et
+ * HacheurViderParGeneration<HacheurQuadInt1>, pour plusieurs capacités et nombres de clefs par cycle, puis le coût
+ * de la génération sur les recherches dans une table pleine.
+ *
+ * Usage: banc [cycles = 20000] [clefs de la table pleine = 2000000]
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../TableHachage.h"
+#include "../FoncteurHachage.hpp"
+#include "OutilsBanc.h"
+
+using namespace std;
+using namespace labTableHachage;
+using namespace labTableHachage::banc;
+
+template<class Hacheur>
+static double cycles(size_t reserve, size_t parCycle, size_t nCycles) {
+    TableHachage<int, int, Hacheur> table;
+    table.reserver(reserve);
+    size_t trouvees = 0;
+    Chrono chrono;
+    for (size_t cycle = 0; cycle < nCycles; ++cycle) {
+        table.vider();
+        for (size_t i = 0; i < parCycle; ++i) table.inserer(static_cast<int>(cycle + 7919 * i), static_cast<int>(i));
+        for (size_t i = 0; i < parCycle; ++i) trouvees += table.contient(static_cast<int>(cycle + 7919 * i));
+    }
+    double ns = chrono.nanosecondes() / nCycles;
+    if (trouvees != parCycle * nCycles) cout << "erreur: " << trouvees << " trouvées" << endl;
+    return ns;
+}
+
+template<class Hacheur>
+static void rechercher(const string &nom, const vector<int> &clefs) {
+    TableHachage<int, int, Hacheur> table;
+    for (size_t i = 0; i < clefs.size(); ++i) table.inserer(clefs[i], static_cast<int>(i));
+    size_t trouvees = 0;
+    Chrono chrono;
+    for (int clef: clefs) trouvees += table.contient(clef) + table.contient(clef + 1);
+    cout << nom << ", table pleine: " << chrono.nanosecondes() / (2 * clefs.size()) << " ns/recherche (" << trouvees
+         << ")" << endl;
+}
+
+int main(int argc, char **argv) {
+    size_t nCycles = argument(argc, argv, 1, 20000);
+    size_t n = argument(argc, argv, 2, 2000000);
+
+    for (size_t reserve: {1000, 100000, 1000000}) {
+        for (size_t parCycle: {3, 100}) {
+            double balayage = cycles<HacheurQuadInt1>(reserve, parCycle, nCycles);
+            double generation = cycles<HacheurViderParGeneration<HacheurQuadInt1> >(reserve, parCycle, nCycles);
+            cout << "réserve " << reserve << ", " << parCycle << " clefs/cycle: balayage " << balayage
+                 << " ns/cycle, génération " << generation << " ns/cycle" << endl;
+        }
+    }
+
+    vector<int> clefs;
+    for (size_t i = 0; i < n; ++i) clefs.push_back(static_cast<int>(static_cast<uint32_t>(2 * i) * 0x9e3779b1u));
+    rechercher<HacheurQuadInt1>("HacheurQuadInt1", clefs);
+    rechercher<HacheurViderParGeneration<HacheurQuadInt1> >("HacheurViderParGeneration", clefs);
+    return 0;
+}
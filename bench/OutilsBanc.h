@@ -0,0 +1,104 @@
+/**
+ * \file OutilsBanc.h
+ * \brief Outils communs aux bancs d'essai de TableHachage
+ *
+ * Les bancs d'essai sont des programmes autonomes à compiler en mode release, par exemple:
+ *
+ *     g++ -std=c++17 -O2 -DNDEBUG bench/BancSondageUnique.cpp ContratException.cpp -o banc
+ */
+
+#ifndef OUTILSBANC_H_
+#define OUTILSBANC_H_
+
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace labTableHachage {
+namespace banc {
+
+    /**
+     * \class Chrono
+     * \brief Mesure du temps écoulé depuis la construction ou le dernier appel à repartir
+     */
+    class Chrono {
+    public:
+        Chrono() : m_debut(std::chrono::steady_clock::now()) {}
+
+        void repartir() { m_debut = std::chrono::steady_clock::now(); }
+
+        double nanosecondes() const {
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - m_debut).count();
+        }
+
+    private:
+        std::chrono::steady_clock::time_point m_debut;
+    };
+
+    /**
+     * @brief Lit un paramètre entier sur la ligne de commande
+     * @param argc Le nombre d'arguments
+     * @param argv Les arguments
+     * @param position La position de l'argument cherché
+     * @param defaut La valeur retournée si l'argument est absent
+     */
+    inline size_t argument(int argc, char **argv, int position, size_t defaut) {
+        return argc > position ? std::strtoul(argv[position], nullptr, 10) : defaut;
+    }
+
+    /**
+     * @brief Génère des clefs string aléatoires distinctes de longueur fixe
+     * @param n Le nombre de clefs
+     * @param longueur La longueur de chaque clef
+     * @param graine La graine du générateur
+     */
+    inline std::vector<std::string> clefsAleatoires(size_t n, size_t longueur, unsigned graine = 42) {
+        std::mt19937_64 generateur(graine);
+        std::uniform_int_distribution<int> lettre('a', 'z');
+        std::vector<std::string> clefs;
+        clefs.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            std::string clef = std::to_string(i) + "_";
+            while (clef.size() < longueur) clef.push_back(static_cast<char>(lettre(generateur)));
+            clefs.push_back(clef);
+        }
+        return clefs;
+    }
+
+    /**
+     * \class HacheurCompteur
+     * \brief Enveloppe d'un hacheur qui compte le nombre de positions sondées
+     */
+    template<class Hacheur>
+    class HacheurCompteur : public Hacheur {
+    public:
+        HacheurCompteur(size_t p_tailleTable) : Hacheur(p_tailleTable) {}
+
+        template<typename TypeClef>
+        size_t operator()(const TypeClef &p_clef, size_t p_tentative = 0) const {
+            ++sondages;
+            return Hacheur::operator()(p_clef, p_tentative);
+        }
+
+        size_t indice(size_t p_hash, size_t p_tentative) const {
+            ++sondages;
+            return Hacheur::indice(p_hash, p_tentative);
+        }
+
+        size_t suivant(size_t p_index, size_t p_hash, size_t p_tentative) const {
+            ++sondages;
+            return Hacheur::suivant(p_index, p_hash, p_tentative);
+        }
+
+        static unsigned long long sondages;
+    };
+
+    template<class Hacheur>
+    unsigned long long HacheurCompteur<Hacheur>::sondages = 0;
+
+} // Fin namespace banc
+} // Fin namespace
+
+#endif
@@ -0,0 +1,116 @@
+/**
+ * \file TableHachageChainesTesteur.cpp
+ * \brief Tests unitaires pour la classe TableHachageChaines
+ * \version 0.4
+ * \date octobre 2026
+ *
+ */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "../TableHachage.h"
+#include "../TableHachageChaines.h"
+#include "../FoncteurHachage.hpp"
+#include "gtest/gtest.h"
+#include "../ContratException.h"
+
+using namespace std;
+using namespace labTableHachage;
+
+class TableHachageChainesTest: public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        table.inserer("pomme", 15.3);
+        table.inserer("orange", 12.4);
+        table.inserer("fraise", 16.4);
+        table.inserer("banane", 7.23);
+        table.inserer("poire", 9.45);
+    }
+    TableHachageChaines<double, HacheurQuadStr1> table;
+};
+
+TEST_F(TableHachageChainesTest, insererOk) {
+    EXPECT_EQ(5, table.taille());
+    EXPECT_TRUE(table.contient("pomme"));
+    EXPECT_TRUE(table.contient(string("poire")));
+    EXPECT_FALSE(table.contient("cerise"));
+    EXPECT_FALSE(table.contient("pomm"));
+    EXPECT_EQ(28u, table.octetsClefs());
+    EXPECT_THROW(table.inserer("pomme", 1.0), PreconditionException);
+    table.inserer("", 2.0);
+    EXPECT_EQ(2.0, table.element(""));
+}
+
+TEST_F(TableHachageChainesTest, elementOk) {
+    EXPECT_EQ(15.3, table.element("pomme"));
+    EXPECT_EQ(7.23, table.element("banane"));
+    EXPECT_TRUE(table.trouver("cerise") == nullptr);
+    *table.trouver("fraise") = 1.5;
+    EXPECT_EQ(1.5, table.element("fraise"));
+    EXPECT_THROW(table.element("cerise"), PreconditionException);
+}
+
+TEST_F(TableHachageChainesTest, enleverOk) {
+    table.enlever("pomme");
+    EXPECT_FALSE(table.contient("pomme"));
+    EXPECT_EQ(4, table.taille());
+    EXPECT_THROW(table.enlever("pomme"), PreconditionException);
+    table.inserer("pomme", 1.0);
+    EXPECT_EQ(1.0, table.element("pomme"));
+
+    table.enlever("orange");
+    table.enlever("fraise");
+    table.enlever("banane");
+    EXPECT_EQ(16u, table.octetsClefs());
+    EXPECT_EQ(9.45, table.element("poire"));
+    EXPECT_EQ(1.0, table.element("pomme"));
+    ostringstream flux;
+    flux << table;
+    EXPECT_NE(string::npos, flux.str().find("(poire,9.45)"));
+}
+
+TEST_F(TableHachageChainesTest, rehacherOk) {
+    table.rehacher();
+    EXPECT_EQ(5, table.taille());
+    EXPECT_EQ(16.4, table.element("fraise"));
+    EXPECT_EQ(9.45, table.element("poire"));
+    table.vider();
+    EXPECT_EQ(0, table.taille());
+    EXPECT_EQ(0u, table.octetsClefs());
+    EXPECT_FALSE(table.contient("fraise"));
+}
+
+TEST(TableHachageChainesTestIndv, fluxEnleverAjouterOk) {
+    TableHachageChaines<int, HacheurQuadStr3> table;
+    TableHachage<string, int, HacheurQuadStr3> reference;
+    srand(time(NULL));
+    for (int i = 0; i < 200000; ++i) {
+        string v = "clef de longueur variable " + string(rand() % 40, '-') + to_string(rand() % 3000);
+        EXPECT_EQ(reference.contient(v), table.contient(v));
+        if (table.contient(v)) {
+            table.enlever(v);
+            reference.enlever(v);
+        } else {
+            int element = rand() % 25;
+            table.inserer(v, element);
+            reference.inserer(v, element);
+            EXPECT_EQ(element, table.element(v));
+        }
+    }
+    EXPECT_EQ(reference.taille(), table.taille());
+    for (auto paire: reference) EXPECT_EQ(paire.second, table.element(paire.first));
+}
+
+TEST(TableHachageChainesTestIndv, roulementEffacesOk) {
+    TableHachageChaines<int, HacheurQuadStr3> table(101);
+    for (int i = 0; i < 40; ++i) table.inserer("clef " + to_string(i), i);
+    for (int i = 40; i < 20000; ++i) {
+        table.enlever("clef " + to_string(i - 40));
+        table.inserer("clef " + to_string(i), -i);
+        EXPECT_FALSE(table.contient("absente " + to_string(i)));
+    }
+    EXPECT_EQ(40, table.taille());
+    for (int i = 0; i < 20000 - 40; ++i) EXPECT_FALSE(table.contient("clef " + to_string(i)));
+    for (int i = 20000 - 40; i < 20000; ++i) EXPECT_EQ(-i, table.element("clef " + to_string(i)));
+}
@@ -0,0 +1,95 @@
+/**
+ * \file TableHachageCompacteTesteur.cpp
+ * \brief Tests unitaires pour la classe TableHachageCompacte
+ * \version 0.4
+ * \date octobre 2026
+ *
+ */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "../TableHachage.h"
+#include "../TableHachageCompacte.h"
+#include "../FoncteurHachage.hpp"
+#include "gtest/gtest.h"
+#include "../ContratException.h"
+
+using namespace std;
+using namespace labTableHachage;
+
+class TableHachageCompacteTest: public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        table.inserer("pomme", 15.3);
+        table.inserer("orange", 12.4);
+        table.inserer("fraise", 16.4);
+        table.inserer("banane", 7.23);
+        table.inserer("poire", 9.45);
+    }
+    TableHachageCompacte<string, double, HacheurQuadStr1> table;
+};
+
+TEST_F(TableHachageCompacteTest, insererOk) {
+    EXPECT_EQ(5, table.taille());
+    EXPECT_TRUE(table.contient("pomme"));
+    EXPECT_TRUE(table.contient("poire"));
+    EXPECT_FALSE(table.contient("cerise"));
+    EXPECT_THROW(table.inserer("pomme", 1.0), PreconditionException);
+}
+
+TEST_F(TableHachageCompacteTest, elementOk) {
+    EXPECT_EQ(15.3, table.element("pomme"));
+    EXPECT_EQ(7.23, table.element("banane"));
+    EXPECT_TRUE(table.trouver("cerise") == nullptr);
+    EXPECT_THROW(table.element("cerise"), PreconditionException);
+}
+
+TEST_F(TableHachageCompacteTest, enleverOk) {
+    table.enlever("pomme");
+    EXPECT_FALSE(table.contient("pomme"));
+    EXPECT_EQ(4, table.taille());
+    EXPECT_THROW(table.enlever("pomme"), PreconditionException);
+    table.inserer("pomme", 1.0);
+    EXPECT_EQ(1.0, table.element("pomme"));
+}
+
+TEST_F(TableHachageCompacteTest, rehacherOk) {
+    table.rehacher();
+    EXPECT_EQ(5, table.taille());
+    EXPECT_EQ(16.4, table.element("fraise"));
+    EXPECT_EQ(9.45, table.element("poire"));
+}
+
+TEST(TableHachageCompacteTestIndv, fluxEnleverAjouterOk) {
+    TableHachageCompacte<int, int, HacheurQuadInt1> table;
+    TableHachage<int, int, HacheurQuadInt1> reference;
+    srand(time(NULL));
+    for (int i = 0; i < 200000; ++i) {
+        int v = rand() % 3000;
+        EXPECT_EQ(reference.contient(v), table.contient(v));
+        if (table.contient(v)) {
+            table.enlever(v);
+            reference.enlever(v);
+        } else {
+            int element = rand() % 25;
+            table.inserer(v, element);
+            reference.inserer(v, element);
+            EXPECT_EQ(element, table.element(v));
+        }
+    }
+    EXPECT_EQ(reference.taille(), table.taille());
+}
+
+TEST(TableHachageCompacteTestIndv, roulementEffacesOk) {
+    TableHachageCompacte<int, int, HacheurQuadInt1> table(101);
+    for (int i = 0; i < 40; ++i) table.inserer(i, i);
+    for (int i = 40; i < 20000; ++i) {
+        table.enlever(i - 40);
+        table.inserer(i, -i);
+        EXPECT_FALSE(table.contient(-i));
+    }
+    EXPECT_EQ(40, table.taille());
+    for (int i = 0; i < 20000 - 40; ++i) EXPECT_FALSE(table.contient(i));
+    for (int i = 20000 - 40; i < 20000; ++i) EXPECT_EQ(-i, table.element(i));
+}
@@ -0,0 +1,85 @@
+/**
+ * \file TableHachageConcurrenteTesteur.cpp
+ * \brief Tests unitaires pour la classe TableHachageConcurrente
+ * \version 0.4
+ * \date octobre 2026
+ *
+ */
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../TableHachageConcurrente.h"
+#include "../FoncteurHachage.hpp"
+#include "gtest/gtest.h"
+#include "../ContratException.h"
+
+using namespace std;
+using namespace labTableHachage;
+
+class TableHachageConcurrenteTest: public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        table.inserer("pomme", 15.3);
+        table.inserer("orange", 12.4);
+        table.inserer("fraise", 16.4);
+        table.inserer("banane", 7.23);
+        table.inserer("poire", 9.45);
+    }
+    TableHachageConcurrente<string, double, HacheurQuadStr1> table;
+};
+
+TEST_F(TableHachageConcurrenteTest, insererOk) {
+    EXPECT_EQ(5, table.taille());
+    EXPECT_EQ(64u, table.nombreSegments());
+    EXPECT_EQ(15.3, table.element("pomme"));
+    EXPECT_FALSE(table.contient("cerise"));
+    EXPECT_THROW(table.inserer("pomme", 1.0), PreconditionException);
+    EXPECT_FALSE(table.insererSiAbsent("pomme", 1.0));
+    EXPECT_FALSE(table.insererOuAssigner("pomme", 1.0));
+    double valeur = 0;
+    EXPECT_TRUE(table.lire("pomme", valeur));
+    EXPECT_EQ(1.0, valeur);
+    EXPECT_FALSE(table.lire("cerise", valeur));
+}
+
+TEST_F(TableHachageConcurrenteTest, enleverOk) {
+    table.enlever("pomme");
+    EXPECT_FALSE(table.contient("pomme"));
+    EXPECT_EQ(4, table.taille());
+    EXPECT_THROW(table.enlever("pomme"), PreconditionException);
+    table.vider();
+    EXPECT_EQ(0, table.taille());
+}
+
+TEST(TableHachageConcurrenteTestIndv, segmentsPuissanceDeuxOk) {
+    TableHachageConcurrente<int, int, HacheurTriangInt1> table(10, 5);
+    EXPECT_EQ(8u, table.nombreSegments());
+    for (int i = 0; i < 10000; ++i) table.inserer(i, -i);
+    for (int i = 0; i < 10000; ++i) EXPECT_EQ(-i, table.element(i));
+}
+
+TEST(TableHachageConcurrenteTestIndv, filsConcurrentsOk) {
+    const int nFils = 8;
+    const int nClefs = 20000;
+    TableHachageConcurrente<int, int, HacheurQuadInt1> table(10, 16);
+    vector<thread> fils;
+    for (int f = 0; f < nFils; ++f) {
+        fils.push_back(thread([&table, f]() {
+            for (int i = f; i < nClefs; i += nFils) table.inserer(i, i);
+            for (int i = f; i < nClefs; i += nFils) {
+                int valeur = -1;
+                if (!table.lire(i, valeur) || valeur != i) return;
+                if (i % 2 == 0) table.enlever(i);
+                table.insererOuAssigner(i + nClefs, i);
+            }
+        }));
+    }
+    for (thread &t: fils) t.join();
+    EXPECT_EQ(nClefs + nClefs / 2, table.taille());
+    for (int i = 0; i < nClefs; ++i) {
+        EXPECT_EQ(i % 2 != 0, table.contient(i));
+        EXPECT_EQ(i, table.element(i + nClefs));
+    }
+}
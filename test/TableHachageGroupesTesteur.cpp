@@ -0,0 +1,105 @@
+/**
+ * \file TableHachageGroupesTesteur.cpp
+ * \brief Tests unitaires pour la classe TableHachageGroupes et pour GroupeControle
+ * \version 0.4
+ * \date octobre 2026
+ *
+ */
+
+#include <iostream>
+#include <string>
+#include "../TableHachage.h"
+#include "../TableHachageGroupes.h"
+#include "../FoncteurHachage.hpp"
+#include "gtest/gtest.h"
+#include "../ContratException.h"
+
+using namespace std;
+using namespace labTableHachage;
+
+TEST(GroupeControle, masquesOk) {
+    uint8_t octets[GroupeControle::LARGEUR];
+    for (size_t i = 0; i < GroupeControle::LARGEUR; ++i) octets[i] = static_cast<uint8_t>(i % 3 == 0 ? 0x80 : i);
+    octets[5] = 0xFE;
+    octets[7] = 0x2A;
+    GroupeControle groupe(octets);
+    uint32_t vacantes = 0, libres = 0, correspondances = 0;
+    for (size_t i = 0; i < GroupeControle::LARGEUR; ++i) {
+        if (octets[i] == 0x80) vacantes |= 1u << i;
+        if (octets[i] & 0x80) libres |= 1u << i;
+        if (octets[i] == 0x2A) correspondances |= 1u << i;
+    }
+    EXPECT_EQ(vacantes, groupe.vacantes());
+    EXPECT_EQ(libres, groupe.libres());
+    EXPECT_EQ(correspondances, groupe.correspondances(0x2A));
+    EXPECT_EQ(7u, premierBit(groupe.correspondances(0x2A)));
+}
+
+class TableHachageGroupesTest: public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        table.inserer("pomme", 15.3);
+        table.inserer("orange", 12.4);
+        table.inserer("fraise", 16.4);
+        table.inserer("banane", 7.23);
+        table.inserer("poire", 9.45);
+    }
+    TableHachageGroupes<string, double, HacheurQuadStr1> table;
+};
+
+TEST_F(TableHachageGroupesTest, insererOk) {
+    EXPECT_EQ(5, table.taille());
+    EXPECT_TRUE(table.contient("pomme"));
+    EXPECT_TRUE(table.contient("poire"));
+    EXPECT_FALSE(table.contient("cerise"));
+    EXPECT_THROW(table.inserer("pomme", 1.0), PreconditionException);
+}
+
+TEST_F(TableHachageGroupesTest, enleverOk) {
+    table.enlever("pomme");
+    EXPECT_FALSE(table.contient("pomme"));
+    EXPECT_EQ(4, table.taille());
+    EXPECT_THROW(table.enlever("pomme"), PreconditionException);
+    table.inserer("pomme", 1.0);
+    EXPECT_EQ(1.0, table.element("pomme"));
+}
+
+TEST(TableHachageGroupesTestIndv, tauxEleveOk) {
+    TableHachageGroupes<int, int, HacheurTriangInt1> table(1 << 12);
+    size_t capacite = table.capacite();
+    int n = static_cast<int>(capacite * 7 / 8);
+    for (int i = 0; i < n; ++i) table.inserer(i * 7919, i);
+    EXPECT_EQ(capacite, table.capacite());
+    for (int i = 0; i < n; ++i) EXPECT_EQ(i, table.element(i * 7919));
+    for (int i = 0; i < n; ++i) EXPECT_FALSE(table.contient(-1 - i));
+}
+
+TEST(TableHachageGroupesTestIndv, collisionsAuDelaDeLaCouvertureOk) {
+    TableHachageGroupes<int, int, HacheurQuadInt1> table;
+    for (int i = 0; i < 2000; ++i) {
+        table.inserer(7 * i, i);
+        EXPECT_LE(2 * table.taille(), static_cast<int>(table.capacite()));
+    }
+    for (int i = 0; i < 2000; ++i) EXPECT_EQ(i, table.element(7 * i));
+    for (int i = 0; i < 2000; ++i) EXPECT_FALSE(table.contient(7 * i + 1));
+}
+
+TEST(TableHachageGroupesTestIndv, fluxEnleverAjouterOk) {
+    TableHachageGroupes<int, int, HacheurQuadInt1> table;
+    TableHachage<int, int, HacheurQuadInt1> reference;
+    srand(time(NULL));
+    for (int i = 0; i < 200000; ++i) {
+        int v = rand() % 3000;
+        EXPECT_EQ(reference.contient(v), table.contient(v));
+        if (table.contient(v)) {
+            table.enlever(v);
+            reference.enlever(v);
+        } else {
+            int element = rand() % 25;
+            table.inserer(v, element);
+            reference.inserer(v, element);
+            EXPECT_EQ(element, table.element(v));
+        }
+    }
+    EXPECT_EQ(reference.taille(), table.taille());
+}
@@ -0,0 +1,101 @@
+/**
+ * \file TableHachageIncrementaleTesteur.cpp
+ * \brief Tests unitaires pour la classe TableHachageIncrementale
+ * \version 0.4
+ * \date octobre 2026
+ *
+ */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "../TableHachage.h"
+#include "../TableHachageIncrementale.h"
+#include "../FoncteurHachage.hpp"
+#include "gtest/gtest.h"
+#include "../ContratException.h"
+
+using namespace std;
+using namespace labTableHachage;
+
+class TableHachageIncrementaleTest: public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        table.inserer("pomme", 15.3);
+        table.inserer("orange", 12.4);
+        table.inserer("fraise", 16.4);
+        table.inserer("banane", 7.23);
+        table.inserer("poire", 9.45);
+    }
+    TableHachageIncrementale<string, double, HacheurQuadStr1> table;
+};
+
+TEST_F(TableHachageIncrementaleTest, insererOk) {
+    EXPECT_EQ(5, table.taille());
+    EXPECT_EQ(15.3, table.element("pomme"));
+    EXPECT_FALSE(table.contient("cerise"));
+    EXPECT_THROW(table.inserer("pomme", 1.0), PreconditionException);
+}
+
+TEST_F(TableHachageIncrementaleTest, enleverOk) {
+    table.enlever("pomme");
+    EXPECT_FALSE(table.contient("pomme"));
+    EXPECT_EQ(4, table.taille());
+    EXPECT_THROW(table.enlever("pomme"), PreconditionException);
+    EXPECT_EQ(9.45, table.element("poire"));
+}
+
+TEST(TableHachageIncrementaleTestIndv, migrationOk) {
+    TableHachageIncrementale<int, int, HacheurQuadInt1> table(101);
+    int i = 0;
+    while (!table.migrationEnCours()) {
+        table.inserer(i, 2 * i);
+        ++i;
+    }
+    EXPECT_EQ(51, i);
+    EXPECT_EQ(211u, table.capacite());
+    EXPECT_THROW(table.inserer(0, 0), PreconditionException);
+    // Les recherches trouvent les clefs des deux tables et les retraits visent la bonne table
+    for (int j = 0; j < i; ++j) EXPECT_EQ(2 * j, table.element(j));
+    table.enlever(50);
+    table.enlever(0);
+    EXPECT_EQ(i - 2, table.taille());
+    while (table.migrationEnCours()) {
+        table.inserer(i, 2 * i);
+        ++i;
+    }
+    EXPECT_EQ(211u, table.capacite());
+    EXPECT_EQ(i - 2, table.taille());
+    EXPECT_FALSE(table.contient(0));
+    EXPECT_FALSE(table.contient(50));
+    for (int j = 1; j < 50; ++j) EXPECT_EQ(2 * j, table.element(j));
+    ostringstream flux;
+    table.vider();
+    flux << table;
+    EXPECT_EQ("{}", flux.str());
+    EXPECT_EQ(0, table.taille());
+}
+
+TEST(TableHachageIncrementaleTestIndv, fluxEnleverAjouterOk) {
+    TableHachageIncrementale<int, int, HacheurQuadInt1> table(5);
+    TableHachage<int, int, HacheurQuadInt1> reference;
+    srand(time(NULL));
+    for (int i = 0; i < 200000; ++i) {
+        int v = rand() % (i / 20 + 10);
+        EXPECT_EQ(reference.contient(v), table.contient(v));
+        if (table.contient(v) && rand() % 3 == 0) {
+            table.enlever(v);
+            reference.enlever(v);
+        } else if (!table.contient(v)) {
+            int element = rand() % 25;
+            table.inserer(v, element);
+            reference.inserer(v, element);
+        }
+    }
+    EXPECT_EQ(reference.taille(), table.taille());
+    for (int v = 0; v < 10010; ++v) {
+        if (reference.contient(v)) {
+            EXPECT_EQ(reference.element(v), table.element(v));
+        }
+    }
+}
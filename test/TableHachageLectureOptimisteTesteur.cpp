@@ -0,0 +1,108 @@
+/**
+ * \file TableHachageLectureOptimisteTesteur.cpp
+ * \brief Tests unitaires pour la classe TableHachageLectureOptimiste
+ * \version 0.4
+ * \date octobre 2026
+ *
+ */
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "../TableHachageLectureOptimiste.h"
+#include "../FoncteurHachage.hpp"
+#include "gtest/gtest.h"
+#include "../ContratException.h"
+
+using namespace std;
+using namespace labTableHachage;
+
+class TableHachageLectureOptimisteTest: public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        for (int i = 0; i < 5; ++i) table.inserer(i, 1.5 * i);
+    }
+    TableHachageLectureOptimiste<int, double, HacheurQuadInt1> table;
+};
+
+TEST_F(TableHachageLectureOptimisteTest, insererOk) {
+    EXPECT_EQ(5, table.taille());
+    EXPECT_EQ(3.0, table.element(2));
+    EXPECT_FALSE(table.contient(7));
+    EXPECT_THROW(table.inserer(2, 1.0), PreconditionException);
+    EXPECT_THROW(table.element(7), PreconditionException);
+    EXPECT_FALSE(table.insererOuAssigner(2, 1.0));
+    EXPECT_TRUE(table.insererOuAssigner(7, 2.0));
+    double valeur = 0;
+    EXPECT_TRUE(table.lire(2, valeur));
+    EXPECT_EQ(1.0, valeur);
+    EXPECT_FALSE(table.lire(8, valeur));
+}
+
+TEST_F(TableHachageLectureOptimisteTest, enleverEtViderOk) {
+    table.enlever(2);
+    EXPECT_FALSE(table.contient(2));
+    EXPECT_EQ(4, table.taille());
+    EXPECT_THROW(table.enlever(2), PreconditionException);
+    table.inserer(2, 9.0);
+    EXPECT_EQ(9.0, table.element(2));
+    size_t capacite = table.capacite();
+    table.vider();
+    EXPECT_EQ(0, table.taille());
+    EXPECT_EQ(capacite, table.capacite());
+    EXPECT_FALSE(table.contient(0));
+}
+
+TEST(TableHachageLectureOptimisteTestIndv, rehacherEtRecupererOk) {
+    TableHachageLectureOptimiste<int, int, HacheurQuadInt1> table(10);
+    for (int i = 0; i < 10000; ++i) table.inserer(i, -i);
+    for (int i = 0; i < 10000; i += 2) table.enlever(i);
+    for (int i = 0; i < 10000; ++i) {
+        int valeur = 0;
+        EXPECT_EQ(i % 2 != 0, table.lire(i, valeur));
+        if (i % 2 != 0) {
+            EXPECT_EQ(-i, valeur);
+        }
+    }
+    EXPECT_GE(table.capacite(), 10000u);
+    // Aucune lecture n'est en cours: chaque tableau remplacé est libéré immédiatement.
+    EXPECT_EQ(0u, table.nombreTableauxRetires());
+    table.rehacher();
+    EXPECT_EQ(0u, table.nombreTableauxRetires());
+    EXPECT_EQ(5000, table.taille());
+}
+
+TEST(TableHachageLectureOptimisteTestIndv, lecturesPendantModificationsOk) {
+    const int nLecteurs = 6;
+    const int nClefs = 2000;
+    TableHachageLectureOptimiste<int, long, HacheurQuadInt1> table(10);
+    for (int i = 0; i < nClefs; i += 2) table.inserer(i, 3L * i);
+    std::atomic<bool> fini(false);
+    std::atomic<int> incoherences(0);
+    vector<thread> lecteurs;
+    for (int f = 0; f < nLecteurs; ++f) {
+        lecteurs.push_back(thread([&table, &fini, &incoherences, f]() {
+            do {
+                for (int i = f; i < nClefs; i += nLecteurs) {
+                    long valeur = 0;
+                    if (table.lire(i, valeur) && valeur != 3L * i && valeur != -3L * i) ++incoherences;
+                    // Les clefs paires ne sont jamais retirées.
+                    if (i % 2 == 0 && !table.contient(i)) ++incoherences;
+                }
+            } while (!fini.load());
+        }));
+    }
+    for (int tour = 0; tour < 20; ++tour) {
+        for (int i = 1; i < nClefs; i += 2) table.inserer(i, 3L * i);
+        for (int i = 0; i < nClefs; i += 2) table.insererOuAssigner(i, tour % 2 == 0 ? -3L * i : 3L * i);
+        for (int i = 1; i < nClefs; i += 2) table.enlever(i);
+        if (tour % 5 == 0) table.rehacher();
+    }
+    fini.store(true);
+    for (thread &t: lecteurs) t.join();
+    EXPECT_EQ(0, incoherences.load());
+    EXPECT_EQ(nClefs / 2, table.taille());
+    table.rehacher();
+    EXPECT_EQ(0u, table.nombreTableauxRetires());
+}
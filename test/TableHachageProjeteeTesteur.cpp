@@ -0,0 +1,110 @@
+/**
+ * \file TableHachageProjeteeTesteur.cpp
+ * \brief Tests unitaires pour la classe TableHachageProjetee
+ * \version 0.4
+ * \date octobre 2026
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "../TableHachage.h"
+#include "../TableHachageProjetee.h"
+#include "../FoncteurHachage.hpp"
+#include "gtest/gtest.h"
+#include "../ContratException.h"
+
+using namespace std;
+using namespace labTableHachage;
+
+class TableHachageProjeteeTest: public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        fichier = ::testing::TempDir() + "TableHachageProjeteeTest.tbl";
+        source.inserer("pomme", 15);
+        source.inserer("orange", 12);
+        source.inserer("fraise", 16);
+        source.inserer("banane", 7);
+        source.inserer("poire", 9);
+        source.inserer("", 3);
+        source.enlever("fraise");
+        TableHachageProjetee<string, int, HacheurQuadStr3>::sauvegarder(source, fichier);
+    }
+    virtual void TearDown() {
+        remove(fichier.c_str());
+    }
+    TableHachage<string, int, HacheurQuadStr3> source;
+    string fichier;
+};
+
+TEST_F(TableHachageProjeteeTest, ouvrirOk) {
+    TableHachageProjetee<string, int, HacheurQuadStr3> table(fichier);
+    EXPECT_EQ(5, table.taille());
+    EXPECT_EQ(source.capacite(), table.capacite());
+    EXPECT_TRUE(table.contient("pomme"));
+    EXPECT_FALSE(table.contient("fraise"));
+    EXPECT_FALSE(table.contient("pomm"));
+    EXPECT_EQ(9, table.element("poire"));
+    EXPECT_EQ(3, table.element(""));
+    EXPECT_TRUE(table.trouver("cerise") == nullptr);
+    EXPECT_THROW(table.element("cerise"), PreconditionException);
+}
+
+TEST_F(TableHachageProjeteeTest, fichierInvalideOk) {
+    EXPECT_THROW((TableHachageProjetee<string, int, HacheurQuadStr1>(fichier)), runtime_error);
+    EXPECT_THROW((TableHachageProjetee<string, double, HacheurQuadStr3>(fichier)), runtime_error);
+    EXPECT_THROW((TableHachageProjetee<string, int, HacheurQuadStr3>(fichier + ".absent")), runtime_error);
+
+    fstream flux(fichier, ios::in | ios::out | ios::binary);
+    flux.seekp(-2, ios::end);
+    flux.put('#');
+    flux.close();
+    EXPECT_THROW((TableHachageProjetee<string, int, HacheurQuadStr3>(fichier)), runtime_error);
+    TableHachageProjetee<string, int, HacheurQuadStr3> nonVerifiee(fichier, false);
+    EXPECT_EQ(5, nonVerifiee.taille());
+
+    ofstream(fichier, ios::binary | ios::trunc) << "trop court";
+    EXPECT_THROW((TableHachageProjetee<string, int, HacheurQuadStr3>(fichier)), runtime_error);
+}
+
+TEST(TableHachageProjeteeTestIndv, clefsEntieresOk) {
+    string fichier = ::testing::TempDir() + "clefsEntieresOk.tbl";
+    vector<int> clefs;
+    for (uint32_t i = 0; i < 40000; ++i) clefs.push_back(static_cast<int>(i * 0x9e3779b1u));
+    TableHachage<int, double, HacheurDoubleInt1> source;
+    for (int i = 0; i < 20000; ++i) source.inserer(clefs[i], i / 2.0);
+    for (int i = 0; i < 20000; i += 2) source.enlever(clefs[i]);
+    TableHachageProjetee<int, double, HacheurDoubleInt1>::sauvegarder(source, fichier);
+    {
+        TableHachageProjetee<int, double, HacheurDoubleInt1> table(fichier);
+        EXPECT_EQ(source.taille(), table.taille());
+        for (int clef: clefs) {
+            ASSERT_EQ(source.contient(clef), table.contient(clef));
+            if (source.contient(clef)) {
+                EXPECT_EQ(source.element(clef), table.element(clef));
+            }
+        }
+    }
+    pair<int, double> doublons[] = {{1, 1.0}, {2, 2.0}, {1, 3.0}};
+    EXPECT_THROW((TableHachageProjetee<int, double, HacheurQuadInt1>::sauvegarder(doublons, doublons + 3, 7, fichier)),
+                 PreconditionException);
+    remove(fichier.c_str());
+}
+
+TEST(TableHachageProjeteeTestIndv, capaciteTropPetiteOk) {
+    string fichier = "TableHachageProjeteeTesteur_capacite.bin";
+    vector<pair<int, double> > paires;
+    for (int i = 0; i < 80; ++i) paires.push_back(make_pair(7 * i, i / 2.0));
+    EXPECT_THROW((TableHachageProjetee<int, double, HacheurQuadInt1>::sauvegarder(paires.begin(), paires.end(), 101,
+                                                                                 fichier)), PreconditionException);
+    paires.resize(50);
+    TableHachageProjetee<int, double, HacheurQuadInt1>::sauvegarder(paires.begin(), paires.end(), 101, fichier);
+    TableHachageProjetee<int, double, HacheurQuadInt1> table(fichier);
+    EXPECT_EQ(50, table.taille());
+    for (int i = 0; i < 50; ++i) EXPECT_EQ(i / 2.0, table.element(7 * i));
+    for (int i = 0; i < 50; ++i) EXPECT_FALSE(table.contient(7 * i + 1));
+    remove(fichier.c_str());
+}
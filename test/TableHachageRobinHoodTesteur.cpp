@@ -0,0 +1,87 @@
+/**
+ * \file TableHachageRobinHoodTesteur.cpp
+ * \brief Tests unitaires pour la classe TableHachageRobinHood
+ * \version 0.4
+ * \date octobre 2026
+ *
+ */
+
+#include <iostream>
+#include <string>
+#include "../TableHachage.h"
+#include "../TableHachageRobinHood.h"
+#include "../FoncteurHachage.hpp"
+#include "gtest/gtest.h"
+#include "../ContratException.h"
+
+using namespace std;
+using namespace labTableHachage;
+
+class TableHachageRobinHoodTest: public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        table.inserer("pomme", 15.3);
+        table.inserer("orange", 12.4);
+        table.inserer("fraise", 16.4);
+        table.inserer("banane", 7.23);
+        table.inserer("poire", 9.45);
+    }
+    TableHachageRobinHood<string, double, HacheurQuadStr1> table;
+};
+
+TEST_F(TableHachageRobinHoodTest, insererOk) {
+    EXPECT_EQ(5, table.taille());
+    EXPECT_EQ(15.3, table.element("pomme"));
+    EXPECT_FALSE(table.contient("cerise"));
+    EXPECT_THROW(table.inserer("pomme", 1.0), PreconditionException);
+}
+
+TEST_F(TableHachageRobinHoodTest, enleverOk) {
+    table.enlever("pomme");
+    EXPECT_FALSE(table.contient("pomme"));
+    EXPECT_EQ(4, table.taille());
+    EXPECT_THROW(table.enlever("pomme"), PreconditionException);
+    EXPECT_EQ(9.45, table.element("poire"));
+}
+
+TEST(TableHachageRobinHoodTestIndv, insertionEgaliseLesDistances) {
+    // Avec HacheurQuadInt1 sur 11 positions, 0, 11 et 22 partagent la position de départ 0 et 1 part de 1.
+    TableHachageRobinHood<int, int, HacheurQuadInt1> table(11);
+    table.inserer(1, 0);
+    table.inserer(0, 1);
+    table.inserer(11, 2);
+    table.inserer(22, 3);
+    EXPECT_EQ(2, table.distanceMaximale());
+    EXPECT_EQ(0, table.element(1));
+    EXPECT_EQ(3, table.element(22));
+    EXPECT_FALSE(table.contient(33));
+    table.enlever(0);
+    EXPECT_EQ(2, table.element(11));
+    EXPECT_EQ(3, table.element(22));
+    EXPECT_EQ(0, table.element(1));
+    EXPECT_EQ(1, table.distanceMaximale());
+}
+
+TEST(TableHachageRobinHoodTestIndv, fluxEnleverAjouterOk) {
+    TableHachageRobinHood<int, int, HacheurQuadInt1> table;
+    TableHachage<int, int, HacheurQuadInt1> reference;
+    srand(time(NULL));
+    for (int i = 0; i < 200000; ++i) {
+        int v = rand() % 3000;
+        EXPECT_EQ(reference.contient(v), table.contient(v));
+        if (table.contient(v)) {
+            table.enlever(v);
+            reference.enlever(v);
+        } else {
+            int element = rand() % 25;
+            table.inserer(v, element);
+            reference.inserer(v, element);
+        }
+    }
+    EXPECT_EQ(reference.taille(), table.taille());
+    for (int v = 0; v < 3000; ++v) {
+        if (reference.contient(v)) {
+            EXPECT_EQ(reference.element(v), table.element(v));
+        }
+    }
+}
@@ -7,8 +7,13 @@
  *
  */
 
+#include <algorithm>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 #include "../TableHachage.h"
 #include "../FoncteurHachage.hpp"
@@ -157,3 +162,578 @@ TEST(TableHachageTestIndv, fluxEnleverAjouterOk) {
     cout << "Nombre moyen de collisions par insertion: " << table.statistiques() << endl;
 }
 
+
+TEST_F(TableHachageTest, trouverOk) {
+    ASSERT_TRUE(table.trouver("pomme") != nullptr);
+    EXPECT_EQ(15.3, *table.trouver("pomme"));
+    EXPECT_TRUE(table.trouver("patapouf") == nullptr);
+    *table.trouver("orange") = 1.5;
+    EXPECT_EQ(1.5, table.element("orange"));
+}
+
+TEST_F(TableHachageTest, insererOuAssignerOk) {
+    EXPECT_FALSE(table.insererOuAssigner("pomme", 1.0));
+    EXPECT_EQ(1.0, table.element("pomme"));
+    EXPECT_TRUE(table.insererOuAssigner("cerise", 2.0));
+    EXPECT_EQ(2.0, table.element("cerise"));
+    EXPECT_EQ(9, table.taille());
+}
+
+TEST_F(TableHachageTest, insererSiAbsentOk) {
+    pair<double *, bool> resultat = table.insererSiAbsent("pomme", 1.0);
+    EXPECT_FALSE(resultat.second);
+    EXPECT_EQ(15.3, *resultat.first);
+    resultat = table.insererSiAbsent("cerise", 2.0);
+    EXPECT_TRUE(resultat.second);
+    EXPECT_EQ(2.0, *resultat.first);
+    EXPECT_EQ(9, table.taille());
+}
+
+TEST(TableHachageTestIndv, insererSiAbsentApresRehachageOk) {
+    TableHachage<int, int, HacheurQuadInt1> table(5);
+    for (int i = 0; i < 1000; ++i) {
+        pair<int *, bool> resultat = table.insererSiAbsent(i, 2 * i);
+        EXPECT_TRUE(resultat.second);
+        EXPECT_EQ(2 * i, *resultat.first);
+    }
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(2 * i, table.element(i));
+}
+
+TEST(TableHachageTestIndv, capacitePuissanceDeuxOk) {
+    TableHachage<int, int, HacheurTriangInt1, CapacitePuissanceDeux> table(5);
+    for (int i = 0; i < 5000; ++i) table.inserer(i, i + 1);
+    for (int i = 0; i < 5000; ++i) EXPECT_EQ(i + 1, table.element(i));
+    for (int i = 0; i < 5000; i += 2) table.enlever(i);
+    EXPECT_EQ(2500, table.taille());
+    EXPECT_FALSE(table.contient(0));
+    EXPECT_TRUE(table.contient(1));
+
+    TableHachage<string, double, HacheurTriangStr1, CapacitePuissanceDeux> tableStr;
+    tableStr.inserer("pomme", 15.3);
+    tableStr.inserer("orange", 12.4);
+    EXPECT_EQ(12.4, tableStr.element("orange"));
+}
+
+TEST(TableHachageTestIndv, capaciteDuHacheurParDefautOk) {
+    EXPECT_TRUE((is_same<CapaciteHacheur<HacheurTriangInt1>::type, CapacitePuissanceDeux>::value));
+    EXPECT_TRUE((is_same<CapaciteHacheur<HacheurQuadInt1>::type, CapacitePremiere>::value));
+    EXPECT_FALSE((CapaciteCompatible<HacheurQuadInt1, CapacitePuissanceDeux>::value));
+    EXPECT_FALSE((CapaciteCompatible<HacheurTriangInt1, CapacitePremiere>::value));
+
+    TableHachage<int, int, HacheurTriangInt1> table(5);
+    EXPECT_EQ(8u, table.capacite());
+    for (int i = 0; i < 1000; ++i) table.inserer(i, i + 1);
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(i + 1, table.element(i));
+
+    TableHachage<string, double, HacheurTriangStr1> tableStr;
+    tableStr.inserer("pomme", 15.3);
+    EXPECT_EQ(15.3, tableStr.element("pomme"));
+}
+
+TEST(TableHachageTestIndv, sondageTriangulaireVisiteTout) {
+    const size_t capacite = 64;
+    HacheurTriangInt1 hacheur(capacite);
+    vector<bool> visitees(capacite, false);
+    for (size_t i = 0; i < capacite; ++i) visitees[hacheur(17, i)] = true;
+    for (size_t i = 0; i < capacite; ++i) EXPECT_TRUE(visitees[i]);
+    EXPECT_THROW(HacheurTriangInt1(100), PreconditionException);
+}
+
+TEST(TableHachageTestIndv, politiquesSondageOk) {
+    // suivant calcule incrémentalement la même séquence que indice, même pour un hash qui déborderait.
+    HacheurQuadStr1 quad(101);
+    HacheurCompose<HInt3, SondageLineaire, CapacitePuissanceDeux> lineaire(64);
+    for (size_t hash: {size_t(17), ~size_t(0)}) {
+        size_t index = quad.indice(hash, 0), indexLineaire = lineaire.indice(hash, 0);
+        for (size_t i = 1; i < 300; ++i) {
+            index = quad.suivant(index, hash, i);
+            indexLineaire = lineaire.suivant(indexLineaire, hash, i);
+            EXPECT_EQ(quad.indice(hash, i), index);
+            EXPECT_EQ(lineaire.indice(hash, i), indexLineaire);
+        }
+    }
+    EXPECT_EQ(0u, lineaire.suivant(63, 0, 5));
+
+    TableHachage<int, int, HacheurCompose<HInt3, SondageLineaire, CapacitePuissanceDeux>, CapacitePuissanceDeux> t1;
+    TableHachage<string, int, HacheurCompose<HString3, SondageTriangulaire, CapacitePuissanceDeux>,
+            CapacitePuissanceDeux> t2;
+    for (int i = 0; i < 5000; ++i) {
+        t1.inserer(i, i);
+        t2.inserer(to_string(i), i);
+    }
+    for (int i = 0; i < 5000; i += 2) {
+        t1.enlever(i);
+        t2.enlever(to_string(i));
+    }
+    for (int i = 0; i < 5000; ++i) {
+        EXPECT_EQ(i % 2 == 1, t1.contient(i));
+        EXPECT_EQ(i % 2 == 1, t2.contient(to_string(i)));
+    }
+    EXPECT_THROW((HacheurCompose<HInt3, SondageLineaire, CapacitePuissanceDeux>(100)), PreconditionException);
+}
+
+TEST(TableHachageTestIndv, doubleHachageOk) {
+    // Le pas est premier avec la capacité: la séquence visite toutes les positions, et suivant suit indice.
+    HacheurDoubleStr1 premier(101);
+    HacheurDouble<HInt1, HInt2, CapacitePuissanceDeux> puissanceDeux(64);
+    for (const string &clef: {string("pomme"), string("orange"), string(100, 'x')}) {
+        size_t hash = premier.primaire(clef), index = premier.indice(hash, 0);
+        vector<bool> visitees(101, false);
+        for (size_t i = 0; i < 101; ++i) {
+            if (i > 0) index = premier.suivant(index, hash, i);
+            EXPECT_EQ(premier.indice(hash, i), index);
+            visitees[index] = true;
+        }
+        EXPECT_EQ(101, count(visitees.begin(), visitees.end(), true));
+    }
+    vector<bool> visitees(64, false);
+    for (size_t i = 0; i < 64; ++i) visitees[puissanceDeux(12345, i)] = true;
+    EXPECT_EQ(64, count(visitees.begin(), visitees.end(), true));
+
+    // La table accepte 80 % de remplissage et reste utilisable après beaucoup de retraits.
+    TableHachage<int, int, HacheurDoubleInt1> table;
+    TableHachage<int, int, HacheurQuadInt1> quadratique;
+    table.reserver(10000);
+    quadratique.reserver(10000);
+    EXPECT_LT(table.capacite(), 2 * quadratique.capacite() / 3);
+    for (int i = 0; i < 10000; ++i) table.inserer(i, i);
+    for (int i = 10000; i < 60000; ++i) {
+        table.enlever(i - 10000);
+        table.inserer(i, i);
+    }
+    EXPECT_GT(table.nombreCompactages(), 0u);
+    for (int i = 50000; i < 60000; ++i) EXPECT_EQ(i, table.element(i));
+    EXPECT_FALSE(table.contient(49999));
+}
+
+TEST(TableHachageTestIndv, compactageDesEffacesOk) {
+    TableHachage<int, int, HacheurQuadInt1> table(1000);
+    size_t capacite = table.capacite();
+    for (int i = 0; i < 400; ++i) table.inserer(i, i);
+    for (int i = 400; i < 100000; ++i) {
+        table.enlever(i - 400);
+        table.inserer(i, i);
+        EXPECT_LE(2 * (table.taille() + table.nombreEffaces()), capacite);
+    }
+    EXPECT_EQ(capacite, table.capacite());
+    EXPECT_GT(table.nombreCompactages(), 0u);
+    EXPECT_EQ(400, table.taille());
+    for (int i = 0; i < 100000 - 400; ++i) EXPECT_FALSE(table.contient(i));
+    for (int i = 100000 - 400; i < 100000; ++i) EXPECT_EQ(i, table.element(i));
+}
+
+TEST(TableHachageTestIndv, compactageProcheDuTauxMaxOk) {
+    TableHachage<int, int, HacheurQuadInt1> table(1000);
+    size_t capacite = table.capacite();
+    int vivantes = static_cast<int>(48 * capacite / 100);
+    for (int i = 0; i < vivantes; ++i) table.inserer(i, i);
+    for (int i = vivantes; i < 20000; ++i) {
+        table.enlever(i - vivantes);
+        table.inserer(i, i);
+        EXPECT_LE(2 * (table.taille() + table.nombreEffaces()), table.capacite());
+    }
+    // Un compactage ne libérerait que quelques positions: la table est agrandie, puis compactée à intervalles amortis.
+    EXPECT_GT(table.capacite(), capacite);
+    EXPECT_GT(table.nombreCompactages(), 0u);
+    EXPECT_LE(table.nombreCompactages(), 16 * 20000 / capacite);
+    EXPECT_EQ(vivantes, table.taille());
+    for (int i = 20000 - vivantes; i < 20000; ++i) EXPECT_EQ(i, table.element(i));
+}
+
+TEST(TableHachageTestIndv, viderParGenerationOk) {
+    TableHachage<string, int, HacheurViderParGeneration<HacheurHashConserve<HacheurQuadStr1> > > table;
+    for (int i = 0; i < 100; ++i) table.inserer(to_string(i), i);
+    size_t capacite = table.capacite();
+    table.vider();
+    EXPECT_EQ(0, table.taille());
+    EXPECT_EQ(capacite, table.capacite());
+    EXPECT_FALSE(table.contient("5"));
+    EXPECT_TRUE(table.begin() == table.end());
+    for (int i = 0; i < 50; ++i) table.inserer(to_string(i), -i);
+    EXPECT_EQ(-5, table.element("5"));
+    EXPECT_FALSE(table.contient("75"));
+
+    // Plus de 65536 vidanges: le compteur de génération revient à zéro et les entrées sont remises à vacant.
+    for (int cycle = 0; cycle < 70000; ++cycle) {
+        table.vider();
+        for (int i = 0; i < 3; ++i) table.inserer(to_string(cycle % 100 + i), cycle);
+    }
+    EXPECT_EQ(3, table.taille());
+    int parcourues = 0;
+    for (auto paire: table) {
+        EXPECT_EQ(69999, paire.second);
+        ++parcourues;
+    }
+    EXPECT_EQ(3, parcourues);
+    EXPECT_TRUE(table.contient("99"));
+    EXPECT_FALSE(table.contient("98"));
+
+    // Les retraits et le compactage ignorent les entrées des générations antérieures.
+    TableHachage<int, int, HacheurViderParGeneration<HacheurQuadInt1> > entiers(1000);
+    for (int i = 0; i < 400; ++i) entiers.inserer(i, i);
+    entiers.vider();
+    for (int i = 0; i < 400; ++i) entiers.inserer(i + 1000, i);
+    for (int i = 400; i < 20000; ++i) {
+        entiers.enlever(i + 600);
+        entiers.inserer(i + 1000, i);
+    }
+    EXPECT_GT(entiers.nombreCompactages(), 0u);
+    EXPECT_EQ(400, entiers.taille());
+    EXPECT_FALSE(entiers.contient(0));
+    EXPECT_EQ(19999, entiers.element(20999));
+}
+
+TEST(TableHachageTestIndv, tauxConfigurablesOk) {
+    TableHachage<int, int, HacheurQuadInt1> table;
+    EXPECT_EQ(50, table.reqTauxMax());
+    EXPECT_THROW(table.asgTauxMax(60), PreconditionException);
+    table.asgTauxMax(25);
+    for (int i = 0; i < 1000; ++i) table.inserer(i, i);
+    EXPECT_GE(table.capacite(), 4000u);
+
+    // Sous le taux minimum, un retrait réduit la table à la moitié du taux maximum.
+    EXPECT_THROW(table.asgTauxMin(13), PreconditionException);
+    table.asgTauxMin(10);
+    for (int i = 0; i < 990; ++i) table.enlever(i);
+    EXPECT_LT(table.capacite(), 200u);
+    EXPECT_EQ(10, table.taille());
+    for (int i = 990; i < 1000; ++i) EXPECT_EQ(i, table.element(i));
+    EXPECT_THROW(table.asgTauxMax(20), PreconditionException);
+
+    TableHachage<int, int, HacheurQuadInt1> sansReduction;
+    for (int i = 0; i < 10000; ++i) sansReduction.inserer(i, i);
+    size_t capacite = sansReduction.capacite();
+    for (int i = 0; i < 9000; ++i) sansReduction.enlever(i);
+    EXPECT_EQ(capacite, sansReduction.capacite());
+    sansReduction.ajusterCapacite();
+    EXPECT_EQ(2003u, sansReduction.capacite());
+    for (int i = 9000; i < 10000; ++i) EXPECT_EQ(i, sansReduction.element(i));
+
+    TableHachage<int, int, HacheurQuadInt1> croissance(100);
+    EXPECT_THROW(croissance.asgFacteurCroissance(1), PreconditionException);
+    croissance.asgFacteurCroissance(1.25);
+    for (int i = 0; i < 51; ++i) croissance.inserer(i, i);
+    EXPECT_EQ(127u, croissance.capacite());
+}
+
+/**
+ * \class ValeurCompteuse
+ * \brief Valeur qui compte ses copies, pour vérifier que l'insertion et le rehachage déplacent les valeurs
+ */
+class ValeurCompteuse {
+public:
+    static int copies;
+    int m_valeur;
+
+    explicit ValeurCompteuse(int p_valeur = 0) : m_valeur(p_valeur) {
+    }
+
+    ValeurCompteuse(const ValeurCompteuse &p_source) : m_valeur(p_source.m_valeur) {
+        ++copies;
+    }
+
+    ValeurCompteuse(ValeurCompteuse &&p_source) noexcept: m_valeur(p_source.m_valeur) {
+    }
+
+    ValeurCompteuse &operator=(const ValeurCompteuse &p_source) {
+        m_valeur = p_source.m_valeur;
+        ++copies;
+        return *this;
+    }
+
+    ValeurCompteuse &operator=(ValeurCompteuse &&p_source) noexcept {
+        m_valeur = p_source.m_valeur;
+        return *this;
+    }
+};
+
+int ValeurCompteuse::copies = 0;
+
+TEST(TableHachageTestIndv, insererSansCopieOk) {
+    TableHachage<string, ValeurCompteuse, HacheurQuadStr1> table(5);
+    ValeurCompteuse::copies = 0;
+    for (int i = 0; i < 500; ++i) table.inserer(to_string(i), ValeurCompteuse(i));
+    for (int i = 500; i < 1000; ++i) EXPECT_TRUE(table.emplacer(to_string(i), i).second);
+    for (int i = 0; i < 10000; ++i) {
+        table.enlever(to_string(i));
+        table.emplacer(to_string(i + 1000), i + 1000);
+    }
+    EXPECT_GT(table.nombreCompactages(), 0u);
+    EXPECT_EQ(0, ValeurCompteuse::copies);
+    EXPECT_FALSE(table.emplacer(string("10500"), -1).second);
+    for (int i = 10000; i < 11000; ++i) EXPECT_EQ(i, table.trouver(to_string(i))->m_valeur);
+    EXPECT_EQ(0, ValeurCompteuse::copies);
+}
+
+TEST(TableHachageTestIndv, valeurDeplacableSeulementOk) {
+    TableHachage<int, unique_ptr<int>, HacheurQuadInt1> table(5);
+    for (int i = 0; i < 1000; ++i) table.inserer(int(i), unique_ptr<int>(new int(2 * i)));
+    for (int i = 1000; i < 2000; ++i) table.emplacer(i, new int(2 * i));
+    for (int i = 0; i < 2000; i += 2) table.enlever(i);
+    EXPECT_EQ(1000, table.taille());
+    for (int i = 1; i < 2000; i += 2) EXPECT_EQ(2 * i, **table.trouver(i));
+    EXPECT_EQ(nullptr, table.trouver(0));
+}
+
+TEST(TableHachageTestIndv, reserverOk) {
+    TableHachage<int, int, HacheurQuadInt1> table;
+    table.reserver(10000);
+    size_t capacite = table.capacite();
+    EXPECT_GE(capacite, 20000u);
+    for (int i = 0; i < 10000; ++i) table.inserer(i, i);
+    EXPECT_EQ(capacite, table.capacite());
+    table.reserver(10);
+    EXPECT_EQ(capacite, table.capacite());
+    table.reserver(20000);
+    EXPECT_GE(table.capacite(), 40000u);
+    for (int i = 0; i < 10000; ++i) EXPECT_EQ(i, table.element(i));
+}
+
+TEST(TableHachageTestIndv, rehacherParalleleOk) {
+    TableHachage<int, int, HacheurQuadInt1> table(10);
+    EXPECT_THROW(table.asgFilsRehachage(0), PreconditionException);
+    table.asgFilsRehachage(4);
+    EXPECT_EQ(4u, table.reqFilsRehachage());
+    for (int i = 0; i < 200000; ++i) table.inserer(3 * i, i);
+    for (int i = 0; i < 200000; i += 2) table.enlever(3 * i);
+    table.rehacher();
+    EXPECT_EQ(100000, table.taille());
+    EXPECT_EQ(0u, table.nombreEffaces());
+    for (int i = 0; i < 200000; ++i) EXPECT_EQ(i % 2 != 0, table.contient(3 * i));
+    for (int i = 1; i < 200000; i += 2) EXPECT_EQ(i, table.element(3 * i));
+}
+
+TEST(TableHachageTestIndv, rechercheParLotOk) {
+    TableHachage<int, int, HacheurQuadInt1> table;
+    for (int i = 0; i < 1000; i += 2) table.inserer(i, -i);
+    vector<int> clefs;
+    for (int i = 999; i >= 0; --i) clefs.push_back(i);
+    unique_ptr<bool[]> presents(new bool[clefs.size()]);
+    vector<const int *> valeurs(clefs.size());
+    table.contientLot(clefs.data(), clefs.size(), presents.get());
+    table.trouverLot(clefs.data(), clefs.size(), valeurs.data());
+    for (size_t i = 0; i < clefs.size(); ++i) {
+        EXPECT_EQ(clefs[i] % 2 == 0, presents[i]);
+        EXPECT_EQ(table.trouver(clefs[i]), valeurs[i]);
+    }
+
+    TableHachage<string, double, HacheurQuadStr1> fruits;
+    fruits.inserer("pomme", 15.3);
+    const char *cherchees[] = {"pomme", "cerise"};
+    const double *trouvees[2];
+    fruits.trouverLot(cherchees, 2, trouvees);
+    EXPECT_EQ(15.3, *trouvees[0]);
+    EXPECT_EQ(nullptr, trouvees[1]);
+}
+
+/**
+ * \class HacheurQuadStrCompteur
+ * \brief HacheurQuadStr1 qui compte les appels à primaire
+ */
+class HacheurQuadStrCompteur : public HacheurQuadStr1 {
+public:
+    HacheurQuadStrCompteur(size_t p_tailleTable) : HacheurQuadStr1(p_tailleTable) {}
+
+    size_t primaire(std::string_view p_clef) const {
+        ++appels;
+        return HacheurQuadStr1::primaire(p_clef);
+    }
+
+    static int appels;
+};
+
+int HacheurQuadStrCompteur::appels = 0;
+
+TEST(TableHachageTestIndv, hashConserveOk) {
+    TableHachage<string, int, HacheurHashConserve<HacheurQuadStrCompteur> > table(10);
+    HacheurQuadStrCompteur::appels = 0;
+    for (int i = 0; i < 2000; ++i) table.inserer("clef" + to_string(i), i);
+    // Chaque clef n'est hachée qu'une fois, malgré les rehachages.
+    EXPECT_EQ(2000, HacheurQuadStrCompteur::appels);
+    for (int i = 2000; i < 30000; ++i) {
+        table.enlever("clef" + to_string(i - 2000));
+        table.inserer("clef" + to_string(i), i);
+    }
+    // Une fois par retrait et par insertion, jamais lors des compactages.
+    EXPECT_GT(table.nombreCompactages(), 0u);
+    EXPECT_EQ(2000 + 2 * 28000, HacheurQuadStrCompteur::appels);
+    for (int i = 28000; i < 30000; ++i) EXPECT_EQ(i, table.element("clef" + to_string(i)));
+    EXPECT_FALSE(table.contient("clef0"));
+    EXPECT_TRUE(table.contient(std::string_view("clef29999")));
+}
+
+TEST(TableHachageTestIndv, hacheursRapidesOk) {
+    HString3 hString;
+    string longue(100, 'a');
+    EXPECT_EQ(hString(longue), hString(longue.c_str()));
+    EXPECT_EQ(hString("pomme"), hString(string("pomme")));
+    // Chaque longueur et chaque octet modifié, au début, au milieu ou à la fin, change le hash.
+    vector<size_t> hash;
+    for (size_t longueur = 0; longueur <= longue.size(); ++longueur) {
+        string_view prefixe(longue.data(), longueur);
+        hash.push_back(hString(prefixe));
+        for (size_t i = 0; i < longueur; ++i) {
+            string modifiee(prefixe);
+            modifiee[i] = 'b';
+            hash.push_back(hString(modifiee));
+        }
+    }
+    sort(hash.begin(), hash.end());
+    EXPECT_TRUE(adjacent_find(hash.begin(), hash.end()) == hash.end());
+
+    HInt3 hInt;
+    EXPECT_NE(hInt(1), hInt(2));
+    EXPECT_NE(hInt(-1), hInt(1));
+
+    TableHachage<string, int, HacheurQuadStr3> chaines;
+    TableHachage<int, int, HacheurHashConserve<HacheurQuadInt3> > entiers;
+    for (int i = 0; i < 5000; ++i) {
+        chaines.inserer(longue + to_string(i), i);
+        entiers.inserer(1024 * i, i);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        EXPECT_EQ(i, chaines.element(longue + to_string(i)));
+        EXPECT_EQ(i, entiers.element(1024 * i));
+    }
+}
+
+TEST(TableHachageTestIndv, insererPlageOk) {
+    vector<pair<string, double> > fruits = {{"pomme", 15.3}, {"orange", 12.4}, {"fraise", 16.4}};
+    TableHachage<string, double, HacheurQuadStr1> table(fruits.begin(), fruits.end());
+    EXPECT_EQ(3, table.taille());
+    EXPECT_EQ(12.4, table.element("orange"));
+
+    vector<pair<int, int> > paires;
+    for (int i = 0; i < 10000; ++i) paires.push_back(make_pair(7 * i, i));
+    TableHachage<int, int, HacheurQuadInt1> entiers(paires.begin(), paires.end());
+    size_t capacite = entiers.capacite();
+    EXPECT_EQ(10000, entiers.taille());
+    entiers.inserer(paires.begin(), paires.begin());
+    EXPECT_EQ(capacite, entiers.capacite());
+    for (int i = 0; i < 10000; ++i) EXPECT_EQ(i, entiers.element(7 * i));
+    EXPECT_THROW(entiers.inserer(paires.begin(), paires.begin() + 1), PreconditionException);
+}
+
+TEST_F(TableHachageTest, rechercheClefCompatibleOk) {
+    string tampon = "GET /fraise?orange=1";
+    string_view fraise = string_view(tampon).substr(5, 6);
+    string_view orange = string_view(tampon).substr(12, 6);
+    EXPECT_TRUE(table.contient(fraise));
+    EXPECT_TRUE(table.contient("pomme"));
+    EXPECT_FALSE(table.contient(string_view(tampon).substr(5, 5)));
+    EXPECT_EQ(16.4, table.element(fraise));
+    EXPECT_EQ(12.4, *table.trouver(orange));
+    table.enlever(orange);
+    EXPECT_FALSE(table.contient("orange"));
+    EXPECT_THROW(table.enlever(orange), PreconditionException);
+
+    HacheurQuadStr1 hacheur(101);
+    EXPECT_EQ(hacheur(string("fraise"), 3), hacheur(fraise, 3));
+    EXPECT_EQ(hacheur("fraise", 3), hacheur(fraise, 3));
+    HString2 h2;
+    EXPECT_EQ(h2(string("orange")), h2(orange));
+}
+
+TEST_F(TableHachageTest, elementReferenceOk) {
+    table.element("pomme") += 1.0;
+    EXPECT_EQ(16.3, table.element("pomme"));
+    const TableHachage<string, double, HacheurQuadStr1> &constante = table;
+    const double &poire = constante.element("poire");
+    EXPECT_EQ(&poire, table.trouver("poire"));
+
+    TableHachage<int, ValeurCompteuse, HacheurQuadInt1> valeurs;
+    valeurs.emplacer(1, 10);
+    ValeurCompteuse::copies = 0;
+    EXPECT_EQ(10, valeurs.element(1).m_valeur);
+    EXPECT_EQ(0, ValeurCompteuse::copies);
+}
+
+TEST_F(TableHachageTest, iterateurOk) {
+    table.enlever("banane");
+    double total = 0;
+    int n = 0;
+    for (auto paire: table) {
+        EXPECT_EQ(paire.second, table.element(paire.first));
+        total += paire.second;
+        ++n;
+    }
+    EXPECT_EQ(7, n);
+    EXPECT_DOUBLE_EQ(15.3 + 12.4 + 16.4 + 9.45 + 7.6 + 9.0 + 55.0, total);
+
+    for (auto it = table.begin(); it != table.end(); ++it) it.element() *= 2;
+    EXPECT_EQ(30.6, table.element("pomme"));
+
+    const TableHachage<string, double, HacheurQuadStr1> &constante = table;
+    TableHachage<string, double, HacheurQuadStr1>::IterateurConstant it = table.begin();
+    EXPECT_TRUE(it == constante.begin());
+    EXPECT_EQ(7, std::distance(constante.begin(), constante.end()));
+
+    table.vider();
+    EXPECT_TRUE(table.begin() == table.end());
+}
+
+TEST(TableHachageTestIndv, operateurCrochetsOk) {
+    TableHachage<string, int, HacheurQuadStr1> compteurs(5);
+    string texte[] = {"a", "b", "a", "c", "a", "b"};
+    for (const string &mot: texte) ++compteurs[mot];
+    EXPECT_EQ(3, compteurs.taille());
+    EXPECT_EQ(3, compteurs["a"]);
+    EXPECT_EQ(2, compteurs["b"]);
+    EXPECT_EQ(1, compteurs[string("c")]);
+    EXPECT_EQ(0, compteurs["d"]);
+    EXPECT_EQ(4, compteurs.taille());
+    for (int i = 0; i < 1000; ++i) compteurs[to_string(i)] = i;
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(i, compteurs.element(to_string(i)));
+}
+
+/**
+ * \class RessourceCompteuse
+ * \brief Ressource mémoire qui compte les octets alloués et non encore libérés, puis délègue à new/delete
+ */
+class RessourceCompteuse : public std::pmr::memory_resource {
+public:
+    size_t octets = 0;
+    size_t allocations = 0;
+
+private:
+    void *do_allocate(size_t p_octets, size_t p_alignement) override {
+        octets += p_octets;
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(p_octets, p_alignement);
+    }
+
+    void do_deallocate(void *p_adresse, size_t p_octets, size_t p_alignement) override {
+        octets -= p_octets;
+        std::pmr::new_delete_resource()->deallocate(p_adresse, p_octets, p_alignement);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &p_autre) const noexcept override {
+        return this == &p_autre;
+    }
+};
+
+TEST(TableHachageTestIndv, allocateurOk) {
+    vector<std::pmr::string> clefs;
+    for (int i = 0; i < 1000; ++i) clefs.emplace_back("une clef assez longue pour être allouée " + to_string(i));
+    RessourceCompteuse ressource;
+    std::pmr::memory_resource *defaut = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+    {
+        labTableHachage::pmr::TableHachage<std::pmr::string, std::pmr::string, HacheurQuadStr1> table(&ressource);
+        EXPECT_EQ(&ressource, table.reqAllocateur().resource());
+        for (int i = 0; i < 1000; ++i) table.inserer(clefs[i], clefs[999 - i]);
+        for (int i = 1000; i < 1500; ++i) table.emplacer(to_string(i).c_str(), 100, 'x');
+        for (int i = 0; i < 500; ++i) table.enlever(clefs[i]);
+        EXPECT_EQ(1000, table.taille());
+        EXPECT_EQ(clefs[0], table.element(clefs[999]));
+        EXPECT_EQ(string(100, 'x'), string_view(table.element("1499")));
+        EXPECT_GT(ressource.allocations, 2000u);
+    }
+    std::pmr::set_default_resource(defaut);
+    EXPECT_EQ(0u, ressource.octets);
+
+    std::pmr::monotonic_buffer_resource arene;
+    labTableHachage::pmr::TableHachage<int, std::pmr::string, HacheurQuadInt1> table(10, &arene);
+    for (int i = 0; i < 1000; ++i) table.inserer(i, std::pmr::string(clefs[i].c_str(), &arene));
+    EXPECT_EQ(clefs[7], table.element(7));
+    EXPECT_EQ(&arene, table.element(7).get_allocator().resource());
+}